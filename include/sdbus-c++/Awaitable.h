@@ -28,6 +28,8 @@
 #ifndef SDBUS_CXX_AWAITABLE_H_
 #define SDBUS_CXX_AWAITABLE_H_
 
+#include <sdbus-c++/Executor.h>
+
 #include <atomic>
 #include <cassert>
 #if __has_include(<coroutine>)
@@ -70,6 +72,8 @@ namespace sdbus {
         using result_type = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
         std::variant<result_type, std::exception_ptr> result;
         std::atomic<AwaitableState> status{AwaitableState::NotReady};
+        // Where to resume the coroutine. Resumed directly in the completing thread if null.
+        IExecutor* executor{};
 #ifdef __cpp_lib_coroutine
         // Keep the handle as the last member to mainting ABI compatibility
         // with clients without coroutine support.
@@ -79,7 +83,10 @@ namespace sdbus {
         void resumeCoroutine()
         {
 #ifdef __cpp_lib_coroutine
-            handle.resume();
+            if (executor != nullptr)
+                executor->post([handle = handle](){ handle.resume(); });
+            else
+                handle.resume();
 #endif // __cpp_lib_coroutine
         }
     };
@@ -101,6 +108,13 @@ namespace sdbus {
      * instance, such as IProxy::callMethodAsync with with_awaitable_t tag,
      * or the .getResultAsAwaitable() methods of the high-level API.
      *
+     * By default, the coroutine is resumed in the thread which completes the
+     * operation, i.e. the event loop thread of the connection in case of D-Bus
+     * calls. Code following `co_await` then blocks the event loop until the
+     * coroutine suspends again or finishes. Use resumeOn() to have the coroutine
+     * resumed on an executor instead, e.g. on a thread pool executor created by
+     * createThreadPoolExecutor().
+     *
      * The class represents nothing, i.e. is a simple placeholder class, if the API
      * is used as C++17 or with a standard library not supporting coroutines.
      *
@@ -110,6 +124,28 @@ namespace sdbus {
     {
 #ifdef __cpp_lib_coroutine
     public:
+        /*!
+         * @brief Makes the awaiting coroutine resume on the given executor
+         *
+         * @param[in] executor Executor to post the coroutine continuation to
+         * @return Reference to this awaitable, to be co_await'ed
+         *
+         * The executor must outlive the pending operation. If the operation
+         * has already completed by the time it is co_await'ed, the coroutine
+         * doesn't suspend at all and simply continues in its current thread.
+         *
+         * Code example:
+         * @code
+         * auto reply = co_await proxy->callMethodAsync(call, sdbus::with_awaitable).resumeOn(*executor);
+         * @endcode
+         */
+        Awaitable& resumeOn(IExecutor& executor) noexcept
+        {
+            // Published to the completing thread by the status transition in await_suspend()
+            data_->executor = &executor;
+            return *this;
+        }
+
         // Called when the coroutine is co_await'ed. Returns true if the coroutine should be suspended.
         [[nodiscard]] bool await_ready() const noexcept
         {
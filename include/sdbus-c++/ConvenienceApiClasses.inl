@@ -31,6 +31,7 @@
 #include <sdbus-c++/IObject.h> // NOLINT(misc-header-include-cycle)
 #include <sdbus-c++/IProxy.h> // NOLINT(misc-header-include-cycle)
 #include <sdbus-c++/Message.h>
+#include <sdbus-c++/MessageArena.h>
 #include <sdbus-c++/MethodResult.h>
 #include <sdbus-c++/TypeTraits.h>
 #include <sdbus-c++/Types.h>
@@ -308,7 +309,9 @@ namespace sdbus {
         {
             // Create a tuple of callback input arguments' types, which will be used
             // as a storage for the argument values deserialized from the message.
-            tuple_of_function_input_arg_types_t<Function> args;
+            using ArenaScope = internal::HandlerArenaScope<Function>;
+            const ArenaScope arenaScope;
+            auto args = arenaScope.makeArguments();
 
             // Deserialize input arguments from the message into the tuple (if no error occurred).
             if (!error)
@@ -321,13 +324,13 @@ namespace sdbus {
                 {
                     // Pass message deserialization exceptions to the client via callback error parameter,
                     // instead of propagating them up the message loop call stack.
-                    sdbus::apply(callback, err, args);
+                    sdbus::apply(callback, err, ArenaScope::forwardArguments(args));
                     return;
                 }
             }
 
             // Invoke callback with input arguments from the tuple.
-            sdbus::apply(callback, std::move(error), args);
+            sdbus::apply(callback, std::move(error), ArenaScope::forwardArguments(args));
         };
     }
 
@@ -440,7 +443,9 @@ namespace sdbus {
         {
             // Create a tuple of callback input arguments' types, which will be used
             // as a storage for the argument values deserialized from the signal message.
-            tuple_of_function_input_arg_types_t<Function> signalArgs;
+            using ArenaScope = internal::HandlerArenaScope<Function>;
+            const ArenaScope arenaScope;
+            auto signalArgs = arenaScope.makeArguments();
 
             // The signal handler can take pure signal parameters only, or an additional `std::optional<Error>` as its first
             // parameter. In the former case, if the deserialization fails (e.g. due to signature mismatch),
@@ -457,12 +462,12 @@ namespace sdbus {
                 {
                     // Pass message deserialization exceptions to the client via callback error parameter,
                     // instead of propagating them up the message loop call stack.
-                    sdbus::apply(callback, err, signalArgs);
+                    sdbus::apply(callback, err, ArenaScope::forwardArguments(signalArgs));
                     return;
                 }
 
                 // Invoke callback with no error and input arguments from the tuple.
-                sdbus::apply(callback, std::nullopt, signalArgs);
+                sdbus::apply(callback, std::nullopt, ArenaScope::forwardArguments(signalArgs));
             }
             else
             {
@@ -470,7 +475,7 @@ namespace sdbus {
                 signal >> signalArgs;
 
                 // Invoke callback with input arguments from the tuple.
-                sdbus::apply(callback, signalArgs);
+                sdbus::apply(callback, ArenaScope::forwardArguments(signalArgs));
             }
         };
     }
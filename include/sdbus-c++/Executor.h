@@ -0,0 +1,83 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file Executor.h
+ *
+ * Created on: Oct 16, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_EXECUTOR_H_
+#define SDBUS_CXX_EXECUTOR_H_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace sdbus {
+
+    /********************************************//**
+     * @class IExecutor
+     *
+     * An interface to an execution context which runs posted jobs.
+     *
+     * sdbus-c++ uses executors to resume coroutines suspended on
+     * an Awaitable outside the event loop thread (see Awaitable::resumeOn()).
+     * Users may implement this interface to hook sdbus-c++ coroutines
+     * into their own thread pools or event loops, or use the thread
+     * pool executor provided by createThreadPoolExecutor().
+     *
+     ***********************************************/
+    class IExecutor
+    {
+    public:
+        virtual ~IExecutor() = default;
+
+        /*!
+         * @brief Schedules a job for execution
+         *
+         * @param[in] job The job to run
+         *
+         * The job must be run exactly once, at some later point in time,
+         * possibly in another thread. The function may be called from
+         * any thread, including the event loop thread of a connection,
+         * and must therefore be thread-safe and should not block.
+         */
+        virtual void post(std::function<void()> job) = 0;
+    };
+
+    /*!
+     * @brief Creates an executor which runs posted jobs in a pool of worker threads
+     *
+     * @param[in] threadCount Number of worker threads in the pool
+     * @return Executor instance
+     *
+     * Jobs are distributed among worker threads in a round-robin fashion. Each worker
+     * runs its jobs one after another, in the order of posting. Jobs which have not
+     * started by the time the executor is destroyed are discarded, so the executor shall
+     * outlive all coroutines that may still get resumed on it.
+     *
+     * @throws sdbus::Error in case of failure
+     */
+    [[nodiscard]] std::unique_ptr<IExecutor> createThreadPoolExecutor(std::size_t threadCount);
+
+} // namespace sdbus
+
+#endif /* SDBUS_CXX_EXECUTOR_H_ */
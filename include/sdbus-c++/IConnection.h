@@ -29,7 +29,9 @@
 
 #include <sdbus-c++/TypeTraits.h>
 
+#include <array>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -47,6 +49,17 @@ namespace sdbus {
 
 namespace sdbus {
 
+    /*!
+     * @brief Ordering guarantee of method calls dispatched to worker threads
+     *
+     * See IConnection::enableMultithreadedDispatch() for details.
+     */
+    enum class DispatchOrdering
+    {
+        PerObject,  //!< Method calls on the same object path are handled one after another, in the order of arrival
+        PerSender   //!< Method calls from the same sender are handled one after another, in the order of arrival
+    };
+
     /********************************************//**
      * @class IConnection
      *
@@ -61,6 +74,7 @@ namespace sdbus {
     {
     public:
         struct PollData;
+        struct Metrics;
 
         virtual ~IConnection() = default;
 
@@ -376,6 +390,149 @@ namespace sdbus {
          */
         virtual void releaseName(const ServiceName& name) = 0;
 
+        /*!
+         * @brief Enables dispatching of incoming method calls to a pool of worker threads
+         *
+         * @param[in] workerCount Number of worker threads in the pool
+         * @param[in] ordering Which method calls shall be guaranteed to be handled in the order of arrival
+         *
+         * By default, all D-Bus method handlers of objects on the connection are invoked from within
+         * the event loop thread, one after another. In multi-threaded dispatch mode, the event loop
+         * thread only reads and demultiplexes incoming messages, and hands method calls over to
+         * a pool of worker threads which invoke the method handlers. Method calls falling into the same
+         * ordering category (the same object path, or the same sender, depending on @p ordering) are always
+         * handled by the same worker thread, in the order of their arrival. Others may be handled in parallel.
+         *
+         * Property get/set handlers, signal handlers and async reply handlers are still invoked
+         * from the event loop thread. Within method handlers running in worker threads,
+         * getCurrentlyProcessedMessage() does not provide the method call message.
+         *
+         * Method handlers of an object may be running in worker threads when the object is being
+         * destroyed. Object destruction waits for them to finish. Therefore, an object shall not be
+         * destroyed from within a D-Bus handler running in the event loop thread while this mode is on.
+         *
+         * The mode shall be enabled before the event loop starts processing messages on the connection,
+         * and cannot be disabled afterwards. Pending method calls that have not yet been picked up
+         * by the workers at the time of connection destruction are dropped.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        virtual void enableMultithreadedDispatch(std::size_t workerCount, DispatchOrdering ordering = DispatchOrdering::PerObject) = 0;
+
+        /*!
+         * @brief Starts a batch of outgoing messages on the connection
+         *
+         * @return RAII-style batch handle; the batch is finished when the handle is destroyed
+         *
+         * Normally, each asynchronous method call and each sent message (signal, method reply)
+         * locks the connection on its own, and may additionally wake up the event loop thread
+         * so that the event loop re-evaluates its poll timeout or continues sending out queued data.
+         * When many messages are sent out in a burst, these costs are paid for each of them.
+         *
+         * Within a batch, the connection is locked once for the whole batch, and the event loop
+         * is woken up at most once, at the end of the batch. The batch covers asynchronous method
+         * calls, signal emissions and other messages sent via this connection (through proxies and objects
+         * of this connection as well) from the thread that started the batch. Batches can be nested.
+         *
+         * For the lifetime of the batch, other threads working with the connection, including the
+         * event loop thread, are blocked. Keep the batch short, and don't wait within the batch
+         * for anything that other threads need to do with the connection. Synchronous method calls
+         * made within the batch don't go through the event loop, but block on the connection directly.
+         *
+         * The batch handle shall be destroyed in the same thread it was created in.
+         *
+         * Example of use:
+         * @code
+         * {
+         *     auto batch = connection.startBatch();
+         *     for (const auto& data : dataItems)
+         *         object->emitSignal("dataSignal").onInterface("org.sdbuscpp.Data").withArguments(data);
+         * } // All signals are queued, the event loop gets woken up once here, if needed
+         * @endcode
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        [[nodiscard]] virtual Slot startBatch() = 0;
+
+        /*!
+         * @brief Enables demultiplexing of signals within the connection
+         *
+         * @param[in] pathNamespace Object path namespace of the signals to be demultiplexed
+         *
+         * By default, each signal handler registered on the connection (e.g. by a proxy) installs
+         * its own match rule with the bus daemon, which costs a round trip to the daemon, and
+         * sd-bus tries incoming signals against all installed match rules one after another.
+         * With many proxies (e.g. a proxy per device object), this burdens the daemon as well
+         * as the process, and slows down both proxy creation and signal dispatch.
+         *
+         * In the signal demultiplexing mode, signal handlers for objects within @p pathNamespace
+         * (e.g. `/org/example/devices`) share one match rule with the bus daemon per signal sender,
+         * covering the whole namespace. Incoming signals are routed to the handlers through a hash
+         * index on the object path, interface name and signal name.
+         *
+         * The flip side is that the connection receives all signals of the sender within the namespace,
+         * including ones no handler is interested in. Signal handlers of objects outside the namespace
+         * are registered as usual.
+         *
+         * The mode shall be enabled before signal handlers are registered on the connection, and
+         * cannot be disabled afterwards. It affects only handlers registered after it has been enabled.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        virtual void enableSignalDemultiplexing(const ObjectPath& pathNamespace) = 0;
+
+        /*!
+         * @brief Makes the internal I/O event loop of the connection wait for events through io_uring
+         *
+         * By default, the event loop run by enterEventLoop() or enterEventLoopAsync() calls poll(2) on the bus fd
+         * and two notification event fds after processing each incoming message, and reads the event fds with
+         * separate read(2) calls when they get notified. With io_uring, all pending messages are processed before
+         * the loop goes waiting again, waiting (including re-arming of the watched events) is a single io_uring_enter(2)
+         * call, and the kernel consumes event fd notifications itself. This saves system calls on busy connections.
+         *
+         * The io_uring support is available only if sdbus-c++ was built against Linux headers providing io_uring,
+         * and it requires Linux 5.11 or newer at run time. The mode does not affect external event loops
+         * (see getEventLoopPollData()) nor sd-event integration.
+         *
+         * The mode shall be enabled before the event loop is entered, and cannot be disabled afterwards.
+         *
+         * @throws sdbus::Error in case of failure, with ENOTSUP error code if io_uring is not supported
+         */
+        virtual void enableIoUringEventLoop() = 0;
+
+        /*!
+         * @brief Returns a snapshot of the connection metrics
+         *
+         * @return Current values of the connection metrics
+         *
+         * The counters are maintained all the time, with relaxed atomic operations that don't add
+         * measurable overhead to message processing. Timing metrics (time spent in dispatching
+         * messages and waiting for events, and the histogram of dispatch times) are collected only
+         * once enabled by enableTimingMetrics(), since they need two clock readings per operation.
+         *
+         * The counters are cumulative since the connection has been created. Rates, like messages
+         * processed per second, are computed from the difference of two snapshots. See the Metrics
+         * structure for details on individual metrics.
+         *
+         * The snapshot is not atomic as a whole: individual values may be read while the event loop
+         * is updating others.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        [[nodiscard]] virtual Metrics getMetrics() const = 0;
+
+        /*!
+         * @brief Enables collecting of timing metrics of the connection
+         *
+         * From now on, the connection measures how long each processing of a pending event (i.e.
+         * dispatching of an incoming message, including the execution of its handler) takes, and how
+         * long its internal event loop waits for events. See getMetrics().
+         *
+         * Waiting for events is measured only in the internal event loop, run by enterEventLoop() or
+         * enterEventLoopAsync(). Dispatch time is measured with external event loops, too.
+         */
+        virtual void enableTimingMetrics() = 0;
+
         /*!
          * @struct PollData
          *
@@ -424,6 +581,68 @@ namespace sdbus {
              */
             [[nodiscard]] int getPollTimeout() const;
         };
+
+        /*!
+         * @struct Metrics
+         *
+         * A snapshot of the connection metrics, as returned by getMetrics().
+         */
+        struct Metrics
+        {
+            /*!
+             * Number of buckets of the dispatch time histogram.
+             */
+            static constexpr std::size_t DISPATCH_TIME_HISTOGRAM_SIZE{16};
+
+            /*!
+             * Number of incoming messages received but not yet dispatched, at the time of the snapshot.
+             */
+            uint64_t readQueueSize{};
+
+            /*!
+             * Number of outgoing messages not yet fully written to the bus, at the time of the snapshot.
+             */
+            uint64_t writeQueueSize{};
+
+            /*!
+             * Number of pending events processed so far, which are incoming messages (method calls,
+             * replies, signals) in vast majority, plus internal sd-bus events like connection setup.
+             */
+            uint64_t processedMessages{};
+
+            /*!
+             * Number of asynchronous method calls made through this connection still awaiting a reply,
+             * including synchronous calls that wait for their reply through a running event loop. A call
+             * made with a returned slot (see @c return_slot) counts until its slot is destroyed.
+             */
+            uint64_t pendingAsyncCalls{};
+
+            /*!
+             * Number of match rules installed by this connection, including ones installed on behalf of
+             * signal handlers (one shared rule per signal sender in signal demultiplexing mode).
+             */
+            uint64_t matchRules{};
+
+            /*!
+             * Total time spent processing pending events, including message handlers. Collected only
+             * if timing metrics are enabled.
+             */
+            std::chrono::nanoseconds dispatchTime{};
+
+            /*!
+             * Total time the internal event loop spent waiting for events. Collected only if timing
+             * metrics are enabled.
+             */
+            std::chrono::nanoseconds pollTime{};
+
+            /*!
+             * Histogram of times of processing individual pending events. Bucket 0 counts events
+             * processed in less than 1 microsecond, bucket i counts events processed in [2^(i-1), 2^i)
+             * microseconds, and the last bucket counts everything slower. Collected only if timing
+             * metrics are enabled.
+             */
+            std::array<uint64_t, DISPATCH_TIME_HISTOGRAM_SIZE> dispatchTimeHistogram{};
+        };
     };
 
     template <typename Rep, typename Period>
@@ -32,6 +32,7 @@
 #include <sdbus-c++/TypeTraits.h>
 #include <sdbus-c++/VTableItems.h>
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <string>
@@ -193,6 +194,30 @@ namespace sdbus {
          */
         virtual void emitPropertiesChangedSignal(const char* interfaceName) = 0;
 
+        /*!
+         * @brief Enables or disables coalescing of PropertiesChanged signals on a given interface of this object path
+         *
+         * @param[in] interfaceName Name of an interface
+         * @param[in] interval Minimum interval between two PropertiesChanged signals of the interface, zero disables coalescing
+         *
+         * With coalescing enabled, emitPropertiesChangedSignal() calls for the interface do not emit the signal right away.
+         * They just accumulate names of changed properties, and one merged PropertiesChanged signal carrying current values
+         * of all accumulated properties is emitted once the interval elapses since the first accumulated change, or upon
+         * flushPropertiesChangedSignals(). So properties changed at a high rate produce at most one signal per interval.
+         * The interval is measured by the event loop of the connection, so the connection must be running an event loop
+         * (internal or external one) for the signals to get emitted. Disabling coalescing emits pending changes right away.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        virtual void coalescePropertiesChangedSignals(const InterfaceName& interfaceName, std::chrono::microseconds interval) = 0;
+
+        /*!
+         * @brief Emits pending coalesced PropertiesChanged signals of all interfaces of this object path right away
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        virtual void flushPropertiesChangedSignals() = 0;
+
         /*!
          * @brief Emits InterfacesAdded signal on this object path
          *
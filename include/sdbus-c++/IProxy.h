@@ -379,8 +379,11 @@ namespace sdbus {
          * The call blocks otherwise, waiting for the remote peer to send back a reply or an error,
          * or until the call times out.
          *
-         * While blocking, other concurrent operations (in other threads) on the underlying bus
-         * connection are stalled until the call returns. This is not an issue in vast majority of
+         * If the bus connection runs its internal event loop in another thread, the call is dispatched
+         * through that event loop, and other threads may issue their own (synchronous or asynchronous)
+         * calls on the same connection in the meantime. Otherwise, while blocking, other concurrent
+         * operations (in other threads) on the underlying bus connection are stalled until the call
+         * returns. This is not an issue in vast majority of
          * (simple, single-threaded) applications. In asynchronous, multi-threaded designs involving
          * shared bus connections, this may be an issue. It is advised to instead use an asynchronous
          * callMethod() function overload, which does not block the bus connection, or do the synchronous
@@ -410,8 +413,11 @@ namespace sdbus {
          * The call blocks otherwise, waiting for the remote peer to send back a reply or an error,
          * or until the call times out.
          *
-         * While blocking, other concurrent operations (in other threads) on the underlying bus
-         * connection are stalled until the call returns. This is not an issue in vast majority of
+         * If the bus connection runs its internal event loop in another thread, the call is dispatched
+         * through that event loop, and other threads may issue their own (synchronous or asynchronous)
+         * calls on the same connection in the meantime. Otherwise, while blocking, other concurrent
+         * operations (in other threads) on the underlying bus connection are stalled until the call
+         * returns. This is not an issue in vast majority of
          * (simple, single-threaded) applications. In asynchronous, multi-threaded designs involving
          * shared bus connections, this may be an issue. It is advised to instead use an asynchronous
          * callMethod() function overload, which does not block the bus connection, or do the synchronous
@@ -683,7 +689,8 @@ namespace sdbus {
          * returns. The awaitable should be used to retrieve the result.
          *
          * The coroutine continuation (code after `co_await`) runs on the context of
-         * the bus connection I/O event loop thread.
+         * the bus connection I/O event loop thread, unless an executor is attached
+         * to the awaitable via Awaitable::resumeOn().
          *
          * The default D-Bus method call timeout is used. See IConnection::getMethodCallTimeout().
          *
@@ -0,0 +1,227 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file MemfdArray.h
+ *
+ * Created on: Oct 16, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_MEMFDARRAY_H_
+#define SDBUS_CXX_MEMFDARRAY_H_
+
+#include <sdbus-c++/Error.h>
+#include <sdbus-c++/Message.h>
+#include <sdbus-c++/Types.h>
+#include <sdbus-c++/TypeTraits.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sdbus {
+
+    namespace internal {
+
+        // An immutable payload in a memfd sealed against any modification, mapped read-only
+        class SealedMemfd
+        {
+        public:
+            // Creates a memfd of the given size, lets the filler write the payload into it, and seals it
+            SealedMemfd(std::size_t size, const std::function<void(void*)>& filler);
+            // Maps a memfd received from a peer, after checking that it is sealed
+            explicit SealedMemfd(UnixFd fd);
+            SealedMemfd(const SealedMemfd&) = delete;
+            SealedMemfd& operator=(const SealedMemfd&) = delete;
+            SealedMemfd(SealedMemfd&&) = delete;
+            SealedMemfd& operator=(SealedMemfd&&) = delete;
+            ~SealedMemfd();
+
+            [[nodiscard]] const void* data() const { return data_; }
+            [[nodiscard]] std::size_t size() const { return size_; }
+            [[nodiscard]] const UnixFd& fd() const { return fd_; }
+
+        private:
+            void map();
+
+            UnixFd fd_;
+            void* data_{};
+            std::size_t size_{};
+        };
+
+    } // namespace internal
+
+    /********************************************//**
+     * @class MemfdArray
+     *
+     * Representation of a D-Bus array of trivial D-Bus type elements (integers,
+     * doubles and enums thereof), which travels in a sealed memfd instead of
+     * the message body once it is large.
+     *
+     * Arrays smaller than a threshold are serialized inline, like std::vector.
+     * Larger arrays are put into a memfd which is sealed against modification
+     * and passed along the message as a Unix fd. The receiving side then maps
+     * the memfd read-only, so the payload is neither copied into the message,
+     * nor through the bus socket and the broker, nor out of the message again.
+     *
+     * The D-Bus signature of MemfdArray<T> is `(aTah)`: an inline array, and
+     * an array of at most one Unix fd, exactly one of them being non-empty.
+     * Both sides of a D-Bus interface must therefore use MemfdArray for the
+     * argument. A received MemfdArray is self-contained -- it keeps the memfd
+     * mapping alive independently of the message it was received in. Copies of
+     * a memfd-backed array share the same mapping.
+     *
+     ***********************************************/
+    template <typename T>
+    class MemfdArray
+    {
+        static_assert( signature_of<T>::is_trivial_dbus_type && !std::is_same_v<T, bool>
+                     , "MemfdArray elements must be of trivial D-Bus type other than bool" );
+
+    public:
+        using value_type = T;
+        using const_iterator = const T*;
+
+        // Arrays of at least this many bytes travel in a memfd by default
+        static constexpr std::size_t DEFAULT_THRESHOLD{512 * 1024};
+
+        MemfdArray() = default;
+
+        explicit MemfdArray(std::vector<T> items, std::size_t threshold = DEFAULT_THRESHOLD)
+        {
+            if (items.size() * sizeof(T) < threshold)
+            {
+                items_ = std::move(items);
+                return;
+            }
+
+            auto filler = [&items](void* data){ std::copy(items.begin(), items.end(), static_cast<T*>(data)); };
+            memfd_ = std::make_shared<const internal::SealedMemfd>(items.size() * sizeof(T), filler);
+        }
+
+        /*!
+         * @brief Creates a memfd-backed array of given size, letting the caller write the elements right into the memfd
+         *
+         * @param[in] size Number of array elements
+         * @param[in] filler Callable with (T* data, std::size_t size) parameters which writes the elements
+         *
+         * This spares the copy of the payload from the producer into the memfd.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        template <typename Filler>
+        static MemfdArray create(std::size_t size, Filler&& filler)
+        {
+            MemfdArray array;
+            auto rawFiller = [&](void* data){ std::forward<Filler>(filler)(static_cast<T*>(data), size); };
+            array.memfd_ = std::make_shared<const internal::SealedMemfd>(size * sizeof(T), rawFiller);
+            return array;
+        }
+
+        [[nodiscard]] const T* data() const
+        {
+            return memfd_ ? static_cast<const T*>(memfd_->data()) : items_.data();
+        }
+
+        [[nodiscard]] std::size_t size() const
+        {
+            return memfd_ ? memfd_->size() / sizeof(T) : items_.size();
+        }
+
+        [[nodiscard]] bool empty() const { return size() == 0; }
+        [[nodiscard]] const_iterator begin() const { return data(); }
+        [[nodiscard]] const_iterator end() const { return data() + size(); } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const T& operator[](std::size_t index) const { return data()[index]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        [[nodiscard]] bool isMemfdBacked() const { return memfd_ != nullptr; }
+
+    private:
+        template <typename U>
+        friend Message& operator<<(Message& msg, const MemfdArray<U>& array);
+        template <typename U>
+        friend Message& operator>>(Message& msg, MemfdArray<U>& array);
+
+        std::vector<T> items_;
+        std::shared_ptr<const internal::SealedMemfd> memfd_;
+    };
+
+    template <typename T>
+    Message& operator<<(Message& msg, const MemfdArray<T>& array)
+    {
+        constexpr auto signature = as_null_terminated(signature_of_v<T>);
+
+        msg.openStruct<std::vector<T>, std::vector<UnixFd>>();
+        if (array.memfd_)
+            msg.appendArray(*signature.data(), nullptr, 0);
+        else
+            msg.appendArray(*signature.data(), array.items_.data(), array.items_.size() * sizeof(T));
+        msg.openContainer<UnixFd>();
+        if (array.memfd_)
+            msg << array.memfd_->fd();
+        msg.closeContainer();
+        msg.closeStruct();
+
+        return msg;
+    }
+
+    template <typename T>
+    Message& operator>>(Message& msg, MemfdArray<T>& array)
+    {
+        if (!msg.enterStruct<std::vector<T>, std::vector<UnixFd>>())
+            return msg;
+
+        constexpr auto signature = as_null_terminated(signature_of_v<T>);
+        std::size_t arraySize{};
+        const T* arrayPtr{};
+        msg.readArray(*signature.data(), reinterpret_cast<const void**>(&arrayPtr), &arraySize); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        std::vector<UnixFd> fds;
+        msg >> fds;
+
+        msg.exitStruct();
+
+        SDBUS_THROW_ERROR_IF(fds.size() > 1 || (!fds.empty() && arraySize > 0), "Failed to deserialize memfd array: ambiguous payload", EINVAL);
+        if (!fds.empty())
+        {
+            auto memfd = std::make_shared<const internal::SealedMemfd>(std::move(fds.front()));
+            SDBUS_THROW_ERROR_IF(memfd->size() % sizeof(T) != 0, "Failed to deserialize memfd array: invalid payload size", EINVAL);
+            array.items_.clear();
+            array.memfd_ = std::move(memfd);
+        }
+        else
+        {
+            array.items_.assign(arrayPtr, arrayPtr + arraySize / sizeof(T)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            array.memfd_.reset();
+        }
+
+        return msg;
+    }
+
+    template <typename T>
+    struct signature_of<MemfdArray<T>> : signature_of<Struct<std::vector<T>, std::vector<UnixFd>>>
+    {};
+
+} // namespace sdbus
+
+#endif /* SDBUS_CXX_MEMFDARRAY_H_ */
@@ -33,9 +33,11 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <functional>
+#include <iterator>
 #include <map>
 #ifdef __has_include
 #  if __has_include(<span>)
@@ -43,6 +45,7 @@
 #  endif
 #endif
 #include <string>
+#include <string_view>
 #include <sys/types.h>
 #include <unordered_map>
 #include <utility>
@@ -64,6 +67,54 @@ namespace sdbus {
 
 namespace sdbus {
 
+    /********************************************//**
+     * @class Credentials
+     *
+     * Credentials of the sender of a message, as obtained by Message::getCreds().
+     * The object holds the fields that were requested in the query mask; a getter
+     * of a field that is unavailable throws sdbus::Error.
+     *
+     ***********************************************/
+    class Credentials
+    {
+    public:
+        // Values match the SD_BUS_CREDS_* flags of sd-bus
+        enum Field : uint64_t // NOLINT(performance-enum-size): using size from sd-bus
+        {
+            Pid               = 1ULL << 0,
+            Uid               = 1ULL << 3,
+            Euid              = 1ULL << 4,
+            Gid               = 1ULL << 7,
+            Egid              = 1ULL << 8,
+            SupplementaryGids = 1ULL << 11,
+            SELinuxContext    = 1ULL << 29
+        };
+
+        Credentials() = default;
+        Credentials(const Credentials& other) noexcept;
+        Credentials& operator=(const Credentials& other) noexcept;
+        Credentials(Credentials&& other) noexcept;
+        Credentials& operator=(Credentials&& other) noexcept;
+        ~Credentials();
+
+        pid_t getPid() const;
+        uid_t getUid() const;
+        uid_t getEuid() const;
+        gid_t getGid() const;
+        gid_t getEgid() const;
+        std::vector<gid_t> getSupplementaryGids() const;
+        std::string getSELinuxContext() const;
+
+    private:
+        friend Message;
+
+        Credentials(void* creds, uint64_t mask, internal::IConnection* connection) noexcept;
+
+        void* creds_{};
+        uint64_t mask_{};
+        internal::IConnection* connection_{};
+    };
+
     /********************************************//**
      * @class Message
      *
@@ -98,6 +149,8 @@ namespace sdbus {
         Message& operator<<(const char *item);
         Message& operator<<(const std::string &item);
         Message& operator<<(std::string_view item);
+        template <typename Allocator>
+        Message& operator<<(const std::basic_string<char, std::char_traits<char>, Allocator>& item);
         Message& operator<<(const Variant &item);
         template <typename ...Elements>
         Message& operator<<(const std::variant<Elements...>& value);
@@ -137,6 +190,10 @@ namespace sdbus {
         Message& operator>>(double& item);
         Message& operator>>(char*& item);
         Message& operator>>(std::string &item);
+        // The view borrows the string from the message buffer. It's valid only as long as the message exists.
+        Message& operator>>(std::string_view &item);
+        template <typename Allocator>
+        Message& operator>>(std::basic_string<char, std::char_traits<char>, Allocator>& item);
         Message& operator>>(Variant &item);
         template <typename ...Elements>
         Message& operator>>(std::variant<Elements...>& value);
@@ -206,8 +263,8 @@ namespace sdbus {
         Message& serializeDictionary(const Callback& callback);
         template <typename Key, typename Value>
         Message& serializeDictionary(const std::initializer_list<DictEntry<Key, Value>>& dictEntries);
-        template <typename Key, typename Value, typename Callback>
-        Message& deserializeDictionary(const Callback& callback);
+        template <typename Key, typename Value, typename Callback, typename Allocator = std::allocator<DictEntry<Key, Value>>>
+        Message& deserializeDictionary(const Callback& callback, const Allocator& allocator = {});
 
         explicit operator bool() const;
         void clearFlags();
@@ -237,6 +294,10 @@ namespace sdbus {
         };
         [[nodiscard]] std::string dumpToString(DumpFlags flags) const;
 
+        // Queries credentials of the message sender, containing (at least) the fields given in the mask of Credentials::Field
+        // flags. The result is cached in the message, so further queries of any subset of these fields, as well as the getters
+        // below, reuse it instead of asking the bus again. The reference is valid as long as the message object exists.
+        const Credentials& getCreds(uint64_t mask) const;
         pid_t getCredsPid() const;
         uid_t getCredsUid() const;
         uid_t getCredsEuid() const;
@@ -272,6 +333,7 @@ namespace sdbus {
         void* msg_{};
         internal::IConnection* connection_{};
         mutable bool ok_{true};
+        mutable Credentials creds_;
     };
 
     class MethodCall : public Message
@@ -352,6 +414,12 @@ namespace sdbus {
 
     PlainMessage createPlainMessage();
 
+    template <typename Allocator>
+    inline Message& Message::operator<<(const std::basic_string<char, std::char_traits<char>, Allocator>& item)
+    {
+        return *this << std::string_view{item};
+    }
+
     template <typename ...Elements>
     inline Message& Message::operator<<(const std::variant<Elements...>& value)
     {
@@ -517,6 +585,18 @@ namespace sdbus {
         }
     } // namespace detail
 
+    template <typename Allocator>
+    inline Message& Message::operator>>(std::basic_string<char, std::char_traits<char>, Allocator>& item)
+    {
+        std::string_view str;
+        *this >> str;
+
+        if (*this)
+            item.assign(str);
+
+        return *this;
+    }
+
     template <typename... Elements>
     inline Message& Message::operator>>(std::variant<Elements...>& value)
     {
@@ -628,19 +708,56 @@ namespace sdbus {
         exitContainer();
     }
 
+    namespace detail
+    {
+        // Number of cheap-to-copy array elements buffered on the stack before they get appended to the destination vector
+        template <typename Element>
+        inline constexpr std::size_t array_chunk_size_v = std::max<std::size_t>(1, 1024 / sizeof(Element));
+    } // namespace detail
+
     template <typename Element, typename Allocator>
     void Message::deserializeArraySlow(std::vector<Element, Allocator>& items)
     {
         if(!enterContainer<Element>())
             return;
 
-        while (true)
+        // sd-bus does not reveal the number of elements of an array, so the destination cannot be sized upfront
+        // (capacity reserved by the caller is honored, though).
+        if constexpr (std::is_same_v<Element, bool> || is_fixed_size_dbus_struct_v<Element>)
         {
-            Element elem;
-            if (*this >> elem)
-                items.emplace_back(std::move(elem));
-            else
-                break;
+            // Elements which are cheap to copy are read into a chunk on the stack, and the end of the array is detected
+            // by the failing read. This spares a separate end-of-array query to sd-bus per element. The destination
+            // grows once per chunk, so arrays fitting in one chunk get allocated exactly once.
+            std::array<Element, detail::array_chunk_size_v<Element>> chunk{};
+            bool atEnd{};
+            while (!atEnd)
+            {
+                std::size_t count{};
+                for (; count < chunk.size(); ++count)
+                {
+                    if (!(*this >> chunk[count]))
+                    {
+                        atEnd = true;
+                        break;
+                    }
+                }
+                items.insert(items.end(), chunk.begin(), std::next(chunk.begin(), static_cast<std::ptrdiff_t>(count)));
+            }
+        }
+        else
+        {
+            // Elements are deserialized right in their final place in the vector, which spares a temporary object
+            // and a move per element. The end of the array is checked upfront so that no element gets constructed
+            // (and no reallocation triggered) in vain.
+            while (!isAtEnd(false))
+            {
+                auto& elem = items.emplace_back();
+                if (!(*this >> elem))
+                {
+                    items.pop_back();
+                    break;
+                }
+            }
         }
 
         clearFlags();
@@ -662,7 +779,8 @@ namespace sdbus {
     template <typename Key, typename Value, typename Compare, typename Allocator>
     inline Message& Message::operator>>(std::map<Key, Value, Compare, Allocator>& items)
     {
-        deserializeDictionary<Key, Value>([&items](auto dictEntry){ items.insert(std::move(dictEntry)); });
+        // Dictionaries serialized from ordered maps come in key order, in which case the end hint makes each insertion O(1)
+        deserializeDictionary<Key, Value>([&items](auto dictEntry){ items.emplace_hint(items.end(), std::move(dictEntry)); }, items.get_allocator());
 
         return *this;
     }
@@ -670,20 +788,22 @@ namespace sdbus {
     template <typename Key, typename Value, typename Hash, typename KeyEqual, typename Allocator>
     inline Message& Message::operator>>(std::unordered_map<Key, Value, Hash, KeyEqual, Allocator>& items)
     {
-        deserializeDictionary<Key, Value>([&items](auto dictEntry){ items.insert(std::move(dictEntry)); });
+        deserializeDictionary<Key, Value>([&items](auto dictEntry){ items.insert(std::move(dictEntry)); }, items.get_allocator());
 
         return *this;
     }
 
-    template <typename Key, typename Value, typename Callback>
-    inline Message& Message::deserializeDictionary(const Callback& callback)
+    template <typename Key, typename Value, typename Callback, typename Allocator>
+    inline Message& Message::deserializeDictionary(const Callback& callback, const Allocator& allocator)
     {
         if (!enterContainer<DictEntry<Key, Value>>())
             return *this;
 
         while (true)
         {
-            DictEntry<Key, Value> dictEntry;
+            // Allocator-aware keys and values are created with the allocator of the destination container right away
+            DictEntry<Key, Value> dictEntry{ detail::make_with_allocator<Key>(allocator)
+                                           , detail::make_with_allocator<Value>(allocator) };
             *this >> dictEntry;
             if (!*this)
                 break;
@@ -0,0 +1,240 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file MessageArena.h
+ *
+ * Created on: Oct 16, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_MESSAGEARENA_H_
+#define SDBUS_CXX_MESSAGEARENA_H_
+
+#include <sdbus-c++/TypeTraits.h>
+
+#include <cstddef>
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#ifdef __cpp_lib_memory_resource
+
+namespace sdbus {
+
+    /********************************************//**
+     * @class MessageArena
+     *
+     * A monotonic memory arena for values deserialized from D-Bus messages.
+     *
+     * Message deserialization works with std::pmr strings and containers
+     * (and Struct and std::tuple thereof): nested allocator-aware values
+     * are created with the allocator of their enclosing container. Giving
+     * the outermost value the arena resource therefore makes the whole
+     * value tree, however deeply nested, allocate from the arena. Memory
+     * is handed out by bumping a pointer and is never freed individually;
+     * reset() releases all of it at once.
+     *
+     * The arena starts with a pre-allocated buffer. Should a message need
+     * more, the arena falls back to the heap for the rest, and the next
+     * reset() grows the buffer to the observed high-water mark, so that
+     * steady traffic of similar messages settles at zero heap allocations.
+     *
+     * All values allocated from the arena must be destroyed before reset()
+     * or the destruction of the arena. The class is not thread-safe.
+     *
+     * Method, async reply and signal handlers which take std::pmr (or other
+     * allocator-aware) arguments get their arguments deserialized into a
+     * per-thread handler arena automatically, which is reset after the handler
+     * returns. Arena-backed values must therefore not escape the handler.
+     * Copies of such arguments allocate from the default memory resource, so
+     * they may safely outlive the handler invocation. Handlers which take an
+     * allocator-aware argument by non-const lvalue or rvalue reference (and so
+     * might move it out) get all their arguments from the default memory
+     * resource instead.
+     *
+     ***********************************************/
+    class MessageArena
+    {
+    public:
+        static constexpr std::size_t DEFAULT_INITIAL_SIZE{4096};
+
+        explicit MessageArena(std::size_t initialSize = DEFAULT_INITIAL_SIZE);
+        MessageArena(const MessageArena&) = delete;
+        MessageArena& operator=(const MessageArena&) = delete;
+        MessageArena(MessageArena&&) = delete;
+        MessageArena& operator=(MessageArena&&) = delete;
+        ~MessageArena();
+
+        [[nodiscard]] std::pmr::memory_resource* resource() noexcept;
+        [[nodiscard]] std::pmr::polymorphic_allocator<std::byte> allocator() noexcept;
+
+        // Creates an empty value which, if allocator-aware, allocates from the arena
+        template <typename T>
+        [[nodiscard]] T make()
+        {
+            return detail::make_with_allocator<T>(allocator());
+        }
+
+        void reset() noexcept;
+        [[nodiscard]] std::size_t capacity() const noexcept;
+
+    private:
+        // Heap fallback which keeps track of how much the pre-allocated buffer fell short
+        class OverflowResource : public std::pmr::memory_resource
+        {
+        public:
+            std::size_t allocatedBytes{};
+
+        private:
+            void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+            void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+            [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+        };
+
+        std::unique_ptr<std::byte[]> buffer_; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+        std::size_t capacity_{};
+        OverflowResource overflow_;
+        std::optional<std::pmr::monotonic_buffer_resource> resource_;
+    };
+
+    namespace internal {
+
+        // The per-thread arena used for arguments of handlers. Scopes may nest (e.g. when a handler
+        // processes further messages on the same thread); the arena is reset when the outermost one is left.
+        std::pmr::memory_resource* enterHandlerArena();
+        void leaveHandlerArena() noexcept;
+
+        template <typename Tuple>
+        struct is_allocator_aware_tuple;
+
+        template <typename... Types>
+        struct is_allocator_aware_tuple<std::tuple<Types...>>
+            : std::disjunction<std::uses_allocator<Types, std::pmr::polymorphic_allocator<std::byte>>...>
+        {};
+
+        // A handler parameter through which an arena-backed argument could be moved out of the handler,
+        // taking the arena allocator along, i.e. an allocator-aware parameter taken by non-const lvalue
+        // or rvalue reference
+        template <typename Arg>
+        inline constexpr bool lets_arena_value_escape_v
+            = std::uses_allocator_v<std::decay_t<Arg>, std::pmr::polymorphic_allocator<std::byte>>
+           && std::is_reference_v<Arg> && !std::is_const_v<std::remove_reference_t<Arg>>;
+
+        template <typename Tuple>
+        struct lets_arena_values_escape;
+
+        template <typename... Args>
+        struct lets_arena_values_escape<std::tuple<Args...>>
+            : std::bool_constant<(lets_arena_value_escape_v<Args> || ...)>
+        {};
+
+        // Provides storage for handler arguments, backed by the per-thread handler arena if any of them can
+        // use it and none of them can escape the handler with the arena allocator. The scope must outlive
+        // the arguments, i.e. it must be declared before the argument tuple.
+        template <typename Function, bool Enabled = true>
+        class HandlerArenaScope
+        {
+        public:
+            using Tuple = tuple_of_function_input_arg_types_t<Function>;
+            static constexpr bool uses_arena = Enabled
+                                            && is_allocator_aware_tuple<Tuple>::value
+                                            && !lets_arena_values_escape<typename function_traits<Function>::arguments_type>::value;
+
+            HandlerArenaScope()
+            {
+                if constexpr (uses_arena)
+                    resource_ = enterHandlerArena();
+            }
+
+            HandlerArenaScope(const HandlerArenaScope&) = delete;
+            HandlerArenaScope& operator=(const HandlerArenaScope&) = delete;
+            HandlerArenaScope(HandlerArenaScope&&) = delete;
+            HandlerArenaScope& operator=(HandlerArenaScope&&) = delete;
+
+            ~HandlerArenaScope()
+            {
+                if constexpr (uses_arena)
+                    leaveHandlerArena();
+            }
+
+            [[nodiscard]] Tuple makeArguments() const
+            {
+                if constexpr (uses_arena)
+                    return Tuple(std::allocator_arg, std::pmr::polymorphic_allocator<std::byte>(resource_));
+                else
+                    return Tuple{};
+            }
+
+            // Arguments are moved into the handler, unless they live in the arena (moved values would carry the arena
+            // allocator along and might escape the handler) or the handler takes some of them by non-const lvalue
+            // reference. Handlers taking allocator-aware arguments by rvalue reference don't use the arena, so they
+            // always get their arguments moved.
+            static decltype(auto) forwardArguments(Tuple& args)
+            {
+                if constexpr (!uses_arena && accepts_moved_arguments_v<Function>)
+                    return std::move(args);
+                else
+                    return (args);
+            }
+
+        private:
+            std::pmr::memory_resource* resource_{};
+        };
+
+    } // namespace internal
+
+} // namespace sdbus
+
+#else // __cpp_lib_memory_resource
+
+namespace sdbus::internal {
+
+    // Without std::pmr support, handler arguments are always plain values
+    template <typename Function, bool Enabled = true>
+    struct HandlerArenaScope
+    {
+        using Tuple = tuple_of_function_input_arg_types_t<Function>;
+        static constexpr bool uses_arena = false;
+
+        [[nodiscard]] Tuple makeArguments() const
+        {
+            return Tuple{};
+        }
+
+        // Arguments are moved into the handler, unless it takes some of them by non-const reference
+        static decltype(auto) forwardArguments(Tuple& args)
+        {
+            if constexpr (accepts_moved_arguments_v<Function>)
+                return std::move(args);
+            else
+                return (args);
+        }
+    };
+
+} // namespace sdbus::internal
+
+#endif // __cpp_lib_memory_resource
+
+#endif /* SDBUS_CXX_MESSAGEARENA_H_ */
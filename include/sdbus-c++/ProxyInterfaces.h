@@ -30,6 +30,8 @@
 #include <sdbus-c++/IProxy.h>
 #include <cassert>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 // Forward declarations
 namespace sdbus {
@@ -72,6 +74,19 @@ namespace sdbus {
         std::unique_ptr<IProxy> proxy_;
     };
 
+    namespace detail
+    {
+        // Detects interface classes that provide an unregisterProxy() of their own, as seen from the class joining them
+        template <typename Holder, typename Interface, typename = void>
+        struct has_unregister_proxy : std::false_type
+        {};
+
+        template <typename Holder, typename Interface>
+        struct has_unregister_proxy<Holder, Interface, std::void_t<decltype(std::declval<Holder&>().Interface::unregisterProxy())>>
+            : std::true_type
+        {};
+    } // namespace detail
+
     /********************************************//**
      * @class ProxyInterfaces
      *
@@ -193,12 +208,15 @@ namespace sdbus {
          * @brief Unregisters the proxy so it no more receives signals and async call replies
          *
          * This function must be called in the destructor of the final proxy class that implements ProxyInterfaces.
+         * Interface classes holding subscriptions of their own (like ObjectManagerMirror_proxy) release them
+         * in their unregisterProxy(), which gets called here as well.
          *
          * See underlying @ref IProxy::unregister()
          */
         void unregisterProxy()
         {
             getProxy().unregister();
+            (unregisterInterface<Interfaces>(), ...);
         }
 
         /*!
@@ -210,6 +228,17 @@ namespace sdbus {
         using base_type = ProxyInterfaces;
 
         ~ProxyInterfaces() = default;
+
+    private:
+        // Lets the trait see protected unregisterProxy() of the interface classes
+        template <typename, typename, typename> friend struct detail::has_unregister_proxy;
+
+        template <typename Interface>
+        void unregisterInterface()
+        {
+            if constexpr (detail::has_unregister_proxy<ProxyInterfaces, Interface>::value)
+                Interface::unregisterProxy();
+        }
     };
 
 } // namespace sdbus
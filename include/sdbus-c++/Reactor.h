@@ -0,0 +1,123 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file Reactor.h
+ *
+ * Created on: Oct 16, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_REACTOR_H_
+#define SDBUS_CXX_REACTOR_H_
+
+#include <cstddef>
+#include <memory>
+
+// Forward declarations
+namespace sdbus {
+    class IConnection;
+}
+
+namespace sdbus {
+
+    /********************************************//**
+     * @class IReactor
+     *
+     * An I/O event loop shared by multiple bus connections.
+     *
+     * Instead of running one event loop thread per connection (through
+     * IConnection::enterEventLoopAsync() or through proxies owning their
+     * connections), any number of connections may be attached to a reactor,
+     * whose thread (or a small fixed pool of threads) then drives all of them.
+     * The reactor is built on top of the IConnection::getEventLoopPollData()
+     * and IConnection::processPendingEvent() contract of external event loops.
+     *
+     * Event loops of attached connections shall not be entered in any other way.
+     * Proxies shall be created on attached connections without an event loop
+     * thread of their own (i.e. with connection passed by reference).
+     *
+     ***********************************************/
+    class IReactor
+    {
+    public:
+        virtual ~IReactor() = default;
+
+        /*!
+         * @brief Starts serving the connection in the reactor
+         *
+         * @param[in] connection Bus connection to serve
+         *
+         * The connection must stay alive until it is detached from the reactor,
+         * or until the reactor is destroyed.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        virtual void attach(IConnection& connection) = 0;
+
+        /*!
+         * @brief Stops serving the connection in the reactor
+         *
+         * @param[in] connection Bus connection attached to the reactor before
+         *
+         * When the function returns, the connection is not being processed by the
+         * reactor, and the connection may be destroyed or served in another way.
+         * The function may also be called from within a handler invoked for
+         * the very connection being detached.
+         *
+         * @throws sdbus::Error in case of failure
+         */
+        virtual void detach(IConnection& connection) = 0;
+
+        /*!
+         * @brief Stops serving all connections and joins the reactor threads
+         *
+         * Should a reactor thread have failed (e.g. when waiting for events), all reactor threads
+         * stop, and the failure is reported by this function. It is called by the destructor, too,
+         * which swallows the failure. The function must not be called from within a handler
+         * invoked by the reactor. Stopping a stopped reactor has no effect.
+         *
+         * @throws sdbus::Error if a reactor thread has failed
+         */
+        virtual void stop() = 0;
+    };
+
+    /*!
+     * @brief Creates an epoll-based reactor serving attached connections in a pool of threads
+     *
+     * @param[in] threadCount Number of reactor threads
+     * @return Reactor instance
+     *
+     * Each connection is processed by at most one reactor thread at a time, so handlers
+     * for one connection are never invoked concurrently, while different connections
+     * may be processed in parallel if there are more reactor threads. Connections still
+     * attached when the reactor is destroyed are simply not served anymore.
+     *
+     * A connection whose processing fails (e.g. because the peer of a direct
+     * connection has gone away) is not served by the reactor anymore, but stays
+     * attached until it is detached. A failure of the reactor itself stops all
+     * reactor threads; it is reported by IReactor::stop().
+     *
+     * @throws sdbus::Error in case of failure
+     */
+    [[nodiscard]] std::unique_ptr<IReactor> createReactor(std::size_t threadCount = 1);
+
+} // namespace sdbus
+
+#endif /* SDBUS_CXX_REACTOR_H_ */
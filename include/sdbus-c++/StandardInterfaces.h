@@ -27,12 +27,22 @@
 #ifndef SDBUS_CXX_STANDARDINTERFACES_H_
 #define SDBUS_CXX_STANDARDINTERFACES_H_
 
+#include <sdbus-c++/IConnection.h>
 #include <sdbus-c++/IObject.h>
 #include <sdbus-c++/IProxy.h>
 #include <sdbus-c++/Types.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <map>
+#include <set>
+#include <utility>
 #include <vector>
 
 namespace sdbus {
@@ -322,6 +332,213 @@ namespace sdbus {
         IProxy& m_proxy;
     };
 
+    // Proxy for properties which caches property values locally. An interface is fetched by one GetAll call
+    // upon first access to any of its properties. Since then, its properties are kept current through
+    // PropertiesChanged signals (invalidated properties are re-fetched asynchronously), and reads are served
+    // from the cache without any bus traffic. Reads and cache updates are thread-safe. Cached values are
+    // only as current as PropertiesChanged signals of the remote object make them, so properties that do
+    // not emit changes should be read via Get().
+    class CachedProperties_proxy : public Properties_proxy
+    {
+    public:
+        // An immutable snapshot of cached properties of one interface, not affected by later cache updates
+        using PropertiesSnapshot = std::shared_ptr<const std::map<PropertyName, Variant, std::less<>>>;
+
+    protected:
+        explicit CachedProperties_proxy(IProxy& proxy)
+            : Properties_proxy(proxy)
+            , m_proxy(proxy)
+        {
+        }
+
+        ~CachedProperties_proxy()
+        {
+            // Cancelling takes the bus lock, under which re-fetch callbacks take the cache lock, so cancel only after
+            // the cache lock is released. A callback running meanwhile finds its re-fetch gone and just updates the cache.
+            std::vector<PendingAsyncCall> refetches;
+            {
+                std::lock_guard lock(m_cacheMutex);
+                for (auto& [interfaceName, cache] : m_cache)
+                {
+                    for (auto& [propertyName, call] : cache.refetches)
+                        refetches.push_back(std::move(call));
+                    cache.refetches.clear();
+                }
+            }
+            for (auto& call : refetches)
+                call.cancel();
+        }
+
+        // Called after the cache has been updated by a PropertiesChanged signal or by a re-fetched property
+        virtual void onCachedPropertiesChanged( [[maybe_unused]] const InterfaceName& interfaceName
+                                              , [[maybe_unused]] const std::map<PropertyName, Variant>& changedProperties
+                                              , [[maybe_unused]] const std::vector<PropertyName>& invalidatedProperties )
+        {
+        }
+
+    public:
+        CachedProperties_proxy(const CachedProperties_proxy&) = delete;
+        CachedProperties_proxy& operator=(const CachedProperties_proxy&) = delete;
+        CachedProperties_proxy(CachedProperties_proxy&&) = delete;
+        CachedProperties_proxy& operator=(CachedProperties_proxy&&) = delete;
+
+        Variant getCachedProperty(std::string_view interfaceName, std::string_view propertyName)
+        {
+            auto properties = getCachedProperties(interfaceName);
+            if (auto it = properties->find(propertyName); it != properties->end())
+                return it->second;
+
+            // Invalidated and not re-fetched yet, or not provided by GetAll
+            return Get(interfaceName, propertyName);
+        }
+
+        PropertiesSnapshot getCachedProperties(std::string_view interfaceName)
+        {
+            std::unique_lock lock(m_cacheMutex);
+            auto& cache = cacheOf(interfaceName);
+            if (cache.properties)
+                return cache.properties;
+
+            // Changes signalled while GetAll is in flight are recorded and replayed on top of its result. As the signals
+            // of an object come in order, the last recorded change of a property is at least as new as the GetAll result.
+            ++cache.pendingFetches;
+            lock.unlock();
+            std::map<PropertyName, Variant> fetchedProperties;
+            try
+            {
+                fetchedProperties = GetAll(interfaceName);
+            }
+            catch (...)
+            {
+                lock.lock();
+                if (--cache.pendingFetches == 0)
+                    cache.recordedChanges.clear();
+                throw;
+            }
+            lock.lock();
+
+            std::map<PropertyName, Variant, std::less<>> properties{ std::make_move_iterator(fetchedProperties.begin())
+                                                                   , std::make_move_iterator(fetchedProperties.end()) };
+            for (const auto& change : cache.recordedChanges)
+                applyChange(properties, change.changedProperties, change.invalidatedProperties);
+            if (--cache.pendingFetches == 0)
+                cache.recordedChanges.clear();
+
+            if (!cache.properties) // Could have been populated by a concurrent call meanwhile
+                cache.properties = std::make_shared<const std::map<PropertyName, Variant, std::less<>>>(std::move(properties));
+            return cache.properties;
+        }
+
+    private:
+        struct PropertiesChange
+        {
+            std::map<PropertyName, Variant> changedProperties;
+            std::vector<PropertyName> invalidatedProperties;
+        };
+
+        struct InterfaceCache
+        {
+            PropertiesSnapshot properties; // Null until fetched
+            unsigned int pendingFetches{};
+            std::vector<PropertiesChange> recordedChanges; // While fetches are pending
+            std::map<PropertyName, PendingAsyncCall, std::less<>> refetches; // Of invalidated properties
+        };
+
+        void onPropertiesChanged( const InterfaceName& interfaceName
+                                , const std::map<PropertyName, Variant>& changedProperties
+                                , const std::vector<PropertyName>& invalidatedProperties ) final
+        {
+            {
+                // Signals are always dispatched on the event loop thread, which holds the bus lock already,
+                // so starting and cancelling re-fetches under the cache lock keeps the bus -> cache lock order.
+                std::lock_guard lock(m_cacheMutex);
+                if (auto it = m_cache.find(interfaceName); it != m_cache.end())
+                {
+                    auto& cache = it->second;
+                    updateCache(cache, changedProperties, invalidatedProperties);
+
+                    // A signalled value supersedes a re-fetch in flight
+                    for (const auto& [propertyName, value] : changedProperties)
+                        cancelRefetch(cache, propertyName);
+                    for (const auto& propertyName : invalidatedProperties)
+                    {
+                        cancelRefetch(cache, propertyName);
+                        cache.refetches[propertyName] = m_proxy.getPropertyAsync(propertyName).onInterface(interfaceName).uponReplyInvoke(
+                            [this, interfaceName, propertyName](std::optional<Error> error, Variant value)
+                            {
+                                onPropertyRefetched(interfaceName, propertyName, std::move(error), std::move(value));
+                            });
+                    }
+                }
+            }
+
+            onCachedPropertiesChanged(interfaceName, changedProperties, invalidatedProperties);
+        }
+
+        void onPropertyRefetched(const InterfaceName& interfaceName, const PropertyName& propertyName, std::optional<Error> error, Variant value)
+        {
+            std::map<PropertyName, Variant> changedProperties;
+            {
+                std::lock_guard lock(m_cacheMutex);
+                auto& cache = cacheOf(interfaceName);
+                cache.refetches.erase(propertyName);
+                if (error)
+                    return; // The property stays uncached, and is read remotely on each access
+                changedProperties.emplace(propertyName, std::move(value));
+                updateCache(cache, changedProperties, {});
+            }
+
+            onCachedPropertiesChanged(interfaceName, changedProperties, {});
+        }
+
+        InterfaceCache& cacheOf(std::string_view interfaceName)
+        {
+            auto it = m_cache.find(interfaceName);
+            if (it == m_cache.end())
+                it = m_cache.emplace(InterfaceName{std::string{interfaceName}}, InterfaceCache{}).first;
+            return it->second;
+        }
+
+        static void updateCache( InterfaceCache& cache
+                               , const std::map<PropertyName, Variant>& changedProperties
+                               , const std::vector<PropertyName>& invalidatedProperties )
+        {
+            if (cache.pendingFetches > 0)
+                cache.recordedChanges.push_back({changedProperties, invalidatedProperties});
+
+            if (cache.properties)
+            {
+                // Copy on write, so that snapshots already handed out stay intact
+                auto properties = *cache.properties;
+                applyChange(properties, changedProperties, invalidatedProperties);
+                cache.properties = std::make_shared<const std::map<PropertyName, Variant, std::less<>>>(std::move(properties));
+            }
+        }
+
+        static void applyChange( std::map<PropertyName, Variant, std::less<>>& properties
+                               , const std::map<PropertyName, Variant>& changedProperties
+                               , const std::vector<PropertyName>& invalidatedProperties )
+        {
+            for (const auto& [propertyName, value] : changedProperties)
+                properties.insert_or_assign(propertyName, value);
+            for (const auto& propertyName : invalidatedProperties)
+                properties.erase(propertyName);
+        }
+
+        static void cancelRefetch(InterfaceCache& cache, const PropertyName& propertyName)
+        {
+            if (auto it = cache.refetches.find(propertyName); it != cache.refetches.end())
+            {
+                it->second.cancel();
+                cache.refetches.erase(it);
+            }
+        }
+
+        IProxy& m_proxy;
+        std::mutex m_cacheMutex;
+        std::map<InterfaceName, InterfaceCache, std::less<>> m_cache;
+    };
+
     // Proxy for object manager
     class ObjectManager_proxy
     {
@@ -400,6 +617,369 @@ namespace sdbus {
         IProxy& m_proxy;
     };
 
+    // Proxy for object manager which maintains a local mirror of all objects managed by the remote object manager.
+    // The mirror is populated by one GetManagedObjects call upon proxy registration, and kept current through
+    // InterfacesAdded, InterfacesRemoved and PropertiesChanged signals afterwards, so lookups are served locally
+    // without any bus traffic. Objects are kept ordered by path, which makes lookups by path namespace cheap.
+    // Interfaces and properties of an object are kept in small sorted vectors, and their names are interned,
+    // so names shared by many objects are stored only once. Invalidated properties are dropped from the mirror.
+    // PropertiesChanged signals are only taken from the service instance that answered GetManagedObjects.
+    // Lookups and mirror updates are thread-safe.
+    class ObjectManagerMirror_proxy : public ObjectManager_proxy
+    {
+        static inline const char* OBJECT_MANAGER_INTERFACE_NAME = "org.freedesktop.DBus.ObjectManager";
+        static inline const char* PROPERTIES_INTERFACE_NAME = "org.freedesktop.DBus.Properties";
+
+    protected:
+        explicit ObjectManagerMirror_proxy(IProxy& proxy)
+            : ObjectManager_proxy(proxy)
+            , m_proxy(proxy)
+        {
+        }
+
+        ~ObjectManagerMirror_proxy() = default;
+
+        // Subscribes to the signals and populates the mirror, throws sdbus::Error if GetManagedObjects fails
+        void registerProxy()
+        {
+            ObjectManager_proxy::registerProxy();
+
+            auto call = m_proxy.createMethodCall(InterfaceName{OBJECT_MANAGER_INTERFACE_NAME}, MethodName{"GetManagedObjects"});
+
+            // Only the service's own PropertiesChanged signals are routed to us, not those of every peer on the bus
+            auto match = std::string{"type='signal',interface='"} + PROPERTIES_INTERFACE_NAME + "',member='PropertiesChanged'"
+                       + ",path_namespace='" + m_proxy.getObjectPath() + "'";
+            if (const auto* destination = call.getDestination(); destination != nullptr && *destination != '\0')
+                match += std::string{",sender='"} + destination + "'";
+            m_propertiesChangedSlot = m_proxy.getConnection().addMatch(match, [this](Message msg){ onPropertiesChangedMessage(msg); }, return_slot);
+
+            populateMirror(call);
+        }
+
+        // Releases the PropertiesChanged subscription, called from ProxyInterfaces::unregisterProxy()
+        void unregisterProxy()
+        {
+            m_propertiesChangedSlot.reset();
+        }
+
+        // Called after the mirror has been updated by the respective signal
+        virtual void onMirroredInterfacesAdded( [[maybe_unused]] const ObjectPath& objectPath
+                                              , [[maybe_unused]] const std::map<InterfaceName, std::map<PropertyName, Variant>>& interfacesAndProperties )
+        {
+        }
+
+        virtual void onMirroredInterfacesRemoved( [[maybe_unused]] const ObjectPath& objectPath
+                                                , [[maybe_unused]] const std::vector<InterfaceName>& interfaces )
+        {
+        }
+
+        virtual void onMirroredPropertiesChanged( [[maybe_unused]] const ObjectPath& objectPath
+                                                , [[maybe_unused]] const InterfaceName& interfaceName
+                                                , [[maybe_unused]] const std::map<PropertyName, Variant>& changedProperties
+                                                , [[maybe_unused]] const std::vector<PropertyName>& invalidatedProperties )
+        {
+        }
+
+    public:
+        ObjectManagerMirror_proxy(const ObjectManagerMirror_proxy&) = delete;
+        ObjectManagerMirror_proxy& operator=(const ObjectManagerMirror_proxy&) = delete;
+        ObjectManagerMirror_proxy(ObjectManagerMirror_proxy&&) = delete;
+        ObjectManagerMirror_proxy& operator=(ObjectManagerMirror_proxy&&) = delete;
+
+        // Returns paths of mirrored objects in the given path namespace, i.e. the path itself and all paths below it
+        std::vector<ObjectPath> getMirroredObjectPaths(std::string_view pathNamespace = "/") const
+        {
+            std::vector<ObjectPath> objectPaths;
+            std::lock_guard lock(m_mirrorMutex);
+            forEachObjectIn(pathNamespace, [&objectPaths](const ObjectPath& objectPath, const MirroredObject& /*object*/)
+            {
+                objectPaths.push_back(objectPath);
+            });
+            return objectPaths;
+        }
+
+        std::map<ObjectPath, std::vector<InterfaceName>> getMirroredInterfaces(std::string_view pathNamespace = "/") const
+        {
+            std::map<ObjectPath, std::vector<InterfaceName>> objectsAndInterfaces;
+            std::lock_guard lock(m_mirrorMutex);
+            forEachObjectIn(pathNamespace, [&objectsAndInterfaces](const ObjectPath& objectPath, const MirroredObject& object)
+            {
+                auto& interfaces = objectsAndInterfaces.emplace_hint(objectsAndInterfaces.end(), objectPath, std::vector<InterfaceName>{})->second;
+                interfaces.reserve(object.size());
+                for (const auto& interface : object)
+                    interfaces.emplace_back(std::string{interface.name});
+            });
+            return objectsAndInterfaces;
+        }
+
+        // Returns an empty map if the object or the interface is not mirrored
+        std::map<PropertyName, Variant> getMirroredProperties(std::string_view objectPath, std::string_view interfaceName) const
+        {
+            std::map<PropertyName, Variant> properties;
+            std::lock_guard lock(m_mirrorMutex);
+            if (const auto* interface = findInterface(objectPath, interfaceName); interface != nullptr)
+                for (const auto& [propertyName, value] : interface->properties)
+                    properties.emplace_hint(properties.end(), PropertyName{std::string{propertyName}}, value);
+            return properties;
+        }
+
+        std::optional<Variant> getMirroredProperty(std::string_view objectPath, std::string_view interfaceName, std::string_view propertyName) const
+        {
+            std::lock_guard lock(m_mirrorMutex);
+            const auto* interface = findInterface(objectPath, interfaceName);
+            if (interface == nullptr)
+                return std::nullopt;
+            auto it = std::lower_bound(interface->properties.begin(), interface->properties.end(), propertyName, NameLess{});
+            if (it == interface->properties.end() || it->first != propertyName)
+                return std::nullopt;
+            return it->second;
+        }
+
+    private:
+        struct MirroredInterface
+        {
+            std::string_view name; // Interned
+            std::vector<std::pair<std::string_view, Variant>> properties; // Sorted by interned property names
+        };
+
+        using MirroredObject = std::vector<MirroredInterface>; // Sorted by interface names
+
+        struct NameLess
+        {
+            bool operator()(const MirroredInterface& interface, std::string_view name) const { return interface.name < name; }
+            bool operator()(const std::pair<std::string_view, Variant>& property, std::string_view name) const { return property.first < name; }
+        };
+
+        void populateMirror(const MethodCall& call)
+        {
+            // Signals received while GetManagedObjects is in flight are recorded and replayed on top of its result.
+            // As the signals of a service come in order, the replayed ones lead to the up-to-date state.
+            MethodReply reply;
+            try
+            {
+                reply = m_proxy.callMethod(call);
+            }
+            catch (...)
+            {
+                std::lock_guard lock(m_mirrorMutex);
+                m_recordedUpdates.clear();
+                throw;
+            }
+
+            std::lock_guard lock(m_mirrorMutex);
+            m_serviceName = reply.getSender() != nullptr ? reply.getSender() : "";
+            m_objects.clear();
+
+            // Deserialized right into the mirror, without building the intermediate map of maps of maps
+            reply.enterContainer("{oa{sa{sv}}}");
+            while (reply.enterDictEntry("oa{sa{sv}}"))
+            {
+                ObjectPath objectPath;
+                reply >> objectPath;
+                auto& object = m_objects[std::move(objectPath)];
+                reply.enterContainer("{sa{sv}}");
+                while (reply.enterDictEntry("sa{sv}"))
+                {
+                    InterfaceName interfaceName;
+                    reply >> interfaceName;
+                    MirroredInterface interface{intern(interfaceName), {}};
+                    reply.deserializeDictionary<PropertyName, Variant>([this, &interface](auto property)
+                    {
+                        interface.properties.emplace_back(intern(property.first), std::move(property.second));
+                    });
+                    reply.exitDictEntry();
+                    upsertInterface(object, std::move(interface));
+                }
+                reply.clearFlags();
+                reply.exitContainer();
+                reply.exitDictEntry();
+            }
+            reply.clearFlags();
+            reply.exitContainer();
+
+            for (const auto& update : m_recordedUpdates)
+                update();
+            m_recordedUpdates.clear();
+            m_populated = true;
+        }
+
+        void onInterfacesAdded( const ObjectPath& objectPath
+                              , const std::map<InterfaceName, std::map<PropertyName, Variant>>& interfacesAndProperties ) final
+        {
+            {
+                std::lock_guard lock(m_mirrorMutex);
+                if (!m_populated)
+                {
+                    m_recordedUpdates.emplace_back([this, objectPath, interfacesAndProperties](){ addInterfaces(objectPath, interfacesAndProperties); });
+                    return;
+                }
+                addInterfaces(objectPath, interfacesAndProperties);
+            }
+
+            onMirroredInterfacesAdded(objectPath, interfacesAndProperties);
+        }
+
+        void onInterfacesRemoved(const ObjectPath& objectPath, const std::vector<InterfaceName>& interfaces) final
+        {
+            {
+                std::lock_guard lock(m_mirrorMutex);
+                if (!m_populated)
+                {
+                    m_recordedUpdates.emplace_back([this, objectPath, interfaces](){ removeInterfaces(objectPath, interfaces); });
+                    return;
+                }
+                removeInterfaces(objectPath, interfaces);
+            }
+
+            onMirroredInterfacesRemoved(objectPath, interfaces);
+        }
+
+        void onPropertiesChangedMessage(Message& msg)
+        {
+            ObjectPath objectPath{msg.getPath()};
+            std::string sender{msg.getSender() != nullptr ? msg.getSender() : ""};
+            InterfaceName interfaceName;
+            std::map<PropertyName, Variant> changedProperties;
+            std::vector<PropertyName> invalidatedProperties;
+            msg >> interfaceName >> changedProperties >> invalidatedProperties;
+
+            {
+                std::lock_guard lock(m_mirrorMutex);
+                if (!m_populated)
+                {
+                    m_recordedUpdates.emplace_back([this, sender, objectPath, interfaceName, changedProperties, invalidatedProperties]()
+                    {
+                        (void)changeProperties(sender, objectPath, interfaceName, changedProperties, invalidatedProperties);
+                    });
+                    return;
+                }
+                if (!changeProperties(sender, objectPath, interfaceName, changedProperties, invalidatedProperties))
+                    return;
+            }
+
+            onMirroredPropertiesChanged(objectPath, interfaceName, changedProperties, invalidatedProperties);
+        }
+
+        void addInterfaces(const ObjectPath& objectPath, const std::map<InterfaceName, std::map<PropertyName, Variant>>& interfacesAndProperties)
+        {
+            auto& object = m_objects[objectPath];
+            for (const auto& [interfaceName, properties] : interfacesAndProperties)
+            {
+                MirroredInterface interface{intern(interfaceName), {}};
+                interface.properties.reserve(properties.size());
+                for (const auto& [propertyName, value] : properties)
+                    interface.properties.emplace_back(intern(propertyName), value);
+                upsertInterface(object, std::move(interface));
+            }
+        }
+
+        void removeInterfaces(const ObjectPath& objectPath, const std::vector<InterfaceName>& interfaces)
+        {
+            auto objectIt = m_objects.find(objectPath);
+            if (objectIt == m_objects.end())
+                return;
+
+            auto& object = objectIt->second;
+            for (const auto& interfaceName : interfaces)
+            {
+                auto it = std::lower_bound(object.begin(), object.end(), interfaceName, NameLess{});
+                if (it != object.end() && it->name == interfaceName)
+                    object.erase(it);
+            }
+            if (object.empty())
+                m_objects.erase(objectIt);
+        }
+
+        bool changeProperties( const std::string& sender
+                             , const ObjectPath& objectPath
+                             , const InterfaceName& interfaceName
+                             , const std::map<PropertyName, Variant>& changedProperties
+                             , const std::vector<PropertyName>& invalidatedProperties )
+        {
+            auto* interface = findInterface(objectPath, interfaceName);
+            if (interface == nullptr || (!m_serviceName.empty() && sender != m_serviceName))
+                return false;
+
+            auto& properties = interface->properties;
+            for (const auto& [propertyName, value] : changedProperties)
+            {
+                auto it = std::lower_bound(properties.begin(), properties.end(), propertyName, NameLess{});
+                if (it != properties.end() && it->first == propertyName)
+                    it->second = value;
+                else
+                    properties.emplace(it, intern(propertyName), value);
+            }
+            for (const auto& propertyName : invalidatedProperties)
+            {
+                auto it = std::lower_bound(properties.begin(), properties.end(), propertyName, NameLess{});
+                if (it != properties.end() && it->first == propertyName)
+                    properties.erase(it);
+            }
+            return true;
+        }
+
+        static void upsertInterface(MirroredObject& object, MirroredInterface interface)
+        {
+            auto it = std::lower_bound(object.begin(), object.end(), interface.name, NameLess{});
+            if (it != object.end() && it->name == interface.name)
+                *it = std::move(interface);
+            else
+                object.insert(it, std::move(interface));
+        }
+
+        MirroredInterface* findInterface(std::string_view objectPath, std::string_view interfaceName)
+        {
+            auto objectIt = m_objects.find(objectPath);
+            if (objectIt == m_objects.end())
+                return nullptr;
+            auto& object = objectIt->second;
+            auto it = std::lower_bound(object.begin(), object.end(), interfaceName, NameLess{});
+            return it != object.end() && it->name == interfaceName ? &*it : nullptr;
+        }
+
+        const MirroredInterface* findInterface(std::string_view objectPath, std::string_view interfaceName) const
+        {
+            return const_cast<ObjectManagerMirror_proxy*>(this)->findInterface(objectPath, interfaceName); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+        }
+
+        template <typename Function>
+        void forEachObjectIn(std::string_view pathNamespace, Function&& function) const
+        {
+            if (pathNamespace == "/")
+            {
+                for (const auto& [objectPath, object] : m_objects)
+                    function(objectPath, object);
+                return;
+            }
+
+            // Paths below the namespace are not necessarily adjacent to the namespace path itself (think of "/a-b"
+            // sorting between "/a" and "/a/b"), but they do form a contiguous range of their own
+            if (auto it = m_objects.find(pathNamespace); it != m_objects.end())
+                function(it->first, it->second);
+            std::string prefix{pathNamespace};
+            prefix += '/';
+            for (auto it = m_objects.lower_bound(prefix); it != m_objects.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it)
+                function(it->first, it->second);
+        }
+
+        std::string_view intern(std::string_view name)
+        {
+            auto it = m_names.find(name);
+            if (it == m_names.end())
+                it = m_names.emplace(name).first;
+            return *it;
+        }
+
+        IProxy& m_proxy;
+        mutable std::mutex m_mirrorMutex;
+        bool m_populated{};
+        std::string m_serviceName; // Unique name of the service instance, empty on direct connections
+        std::map<ObjectPath, MirroredObject, std::less<>> m_objects;
+        std::set<std::string, std::less<>> m_names; // Interned interface and property names
+        std::vector<std::function<void()>> m_recordedUpdates; // Until the mirror gets populated
+        Slot m_propertiesChangedSlot; // Declared last to be released first
+    };
+
     // Adaptors for the above-listed standard D-Bus interfaces are not necessary because the functionality
     // is provided by underlying libsystemd implementation. The exception is Properties_adaptor,
     // ObjectManager_adaptor and ManagedObject_adaptor, which provide convenience functionality to emit signals.
@@ -446,6 +1026,16 @@ namespace sdbus {
             m_object.emitPropertiesChangedSignal(interfaceName);
         }
 
+        void coalescePropertiesChangedSignals(const InterfaceName& interfaceName, std::chrono::microseconds interval)
+        {
+            m_object.coalescePropertiesChangedSignals(interfaceName, interval);
+        }
+
+        void flushPropertiesChangedSignals()
+        {
+            m_object.flushPropertiesChangedSignals();
+        }
+
     private:
         IObject& m_object;
     };
@@ -561,6 +1151,63 @@ namespace sdbus {
         IObject& m_object;
     };
 
+    /*!
+     * @brief Connection Statistics Adaptor
+     *
+     * Adding this class as Interfaces.. template parameter of class AdaptorInterfaces implements
+     * the *GetStatistics()* method of the org.sdbuscpp.Statistics interface, which lets monitoring
+     * tools scrape the metrics of the object's connection (see IConnection::getMetrics()) over D-Bus,
+     * e.g. by `busctl call <service> <path> org.sdbuscpp.Statistics GetStatistics`.
+     *
+     * The method returns a dictionary with the following entries: ReadQueueSize, WriteQueueSize,
+     * ProcessedMessages, PendingAsyncCalls, MatchRules (all of type `t`), DispatchTimeNsec and
+     * PollTimeNsec (type `t`, in nanoseconds), and DispatchTimeHistogram (type `at`). Timing
+     * entries stay zero unless timing metrics are enabled on the connection.
+     */
+    class Statistics_adaptor
+    {
+        static inline const char* INTERFACE_NAME = "org.sdbuscpp.Statistics";
+
+    protected:
+        explicit Statistics_adaptor(IObject& object)
+            : m_object(object)
+        {
+        }
+
+        ~Statistics_adaptor() = default;
+
+        void registerAdaptor()
+        {
+            m_object.addVTable( sdbus::registerMethod("GetStatistics")
+                                      .withOutputParamNames("statistics")
+                                      .implementedAs([this](){ return this->getStatistics(); })
+                              ).forInterface(INTERFACE_NAME);
+        }
+
+    public:
+        Statistics_adaptor(const Statistics_adaptor&) = delete;
+        Statistics_adaptor& operator=(const Statistics_adaptor&) = delete;
+        Statistics_adaptor(Statistics_adaptor&&) = delete;
+        Statistics_adaptor& operator=(Statistics_adaptor&&) = delete;
+
+    private:
+        std::map<std::string, Variant> getStatistics() const
+        {
+            const auto metrics = m_object.getConnection().getMetrics();
+
+            return { {"ReadQueueSize", Variant{metrics.readQueueSize}}
+                   , {"WriteQueueSize", Variant{metrics.writeQueueSize}}
+                   , {"ProcessedMessages", Variant{metrics.processedMessages}}
+                   , {"PendingAsyncCalls", Variant{metrics.pendingAsyncCalls}}
+                   , {"MatchRules", Variant{metrics.matchRules}}
+                   , {"DispatchTimeNsec", Variant{static_cast<uint64_t>(metrics.dispatchTime.count())}}
+                   , {"PollTimeNsec", Variant{static_cast<uint64_t>(metrics.pollTime.count())}}
+                   , {"DispatchTimeHistogram", Variant{std::vector<uint64_t>(metrics.dispatchTimeHistogram.begin(), metrics.dispatchTimeHistogram.end())}} };
+        }
+
+        IObject& m_object;
+    };
+
 } // namespace sdbus
 
 #endif /* SDBUS_CXX_STANDARDINTERFACES_H_ */
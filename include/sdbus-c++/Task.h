@@ -0,0 +1,235 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file Task.h
+ *
+ * Created on: Oct 16, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_TASK_H_
+#define SDBUS_CXX_TASK_H_
+
+#include <sdbus-c++/TypeTraits.h>
+
+#if __has_include(<coroutine>)
+#include <coroutine>
+#endif
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#ifdef __cpp_lib_coroutine
+
+namespace sdbus {
+
+    namespace internal {
+
+        template <typename T>
+        class TaskPromise;
+
+    } // namespace internal
+
+    /********************************************//**
+     * @class Task
+     *
+     * A C++20 coroutine type for server-side D-Bus method handlers.
+     *
+     * A method handler registered through MethodVTableItem::implementedAs()
+     * may be a coroutine returning Task<T>, where T is the method output type
+     * (void, a single type, or std::tuple<Types...> for multiple output values).
+     * Such a handler may `co_await` other asynchronous operations, typically
+     * D-Bus calls made via Awaitable-based proxy API, without blocking the
+     * event loop thread. The method reply (or an error reply, should the
+     * coroutine exit with an exception) is sent once the coroutine finishes.
+     *
+     * The coroutine is lazy: it starts running only when co_await'ed. Task
+     * objects can therefore also be used to compose coroutines, i.e. one
+     * Task-returning coroutine can `co_await` another one.
+     *
+     * The coroutine runs in the thread that invoked the handler up to its
+     * first suspension point. After that, it is resumed by whoever completes
+     * the awaited operation (e.g. the event loop thread of the proxy connection
+     * in case of an Awaitable-based D-Bus call).
+     *
+     * The class is available only with C++20 standard library supporting coroutines.
+     *
+     ***********************************************/
+    template <typename T>
+    class [[nodiscard]] Task
+    {
+    public:
+        using promise_type = internal::TaskPromise<T>;
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        Task(Task&& other) noexcept
+            : handle_(std::exchange(other.handle_, {}))
+        {
+        }
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (handle_)
+                    handle_.destroy();
+                handle_ = std::exchange(other.handle_, {});
+            }
+            return *this;
+        }
+
+        ~Task()
+        {
+            if (handle_)
+                handle_.destroy();
+        }
+
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return !handle_ || handle_.done();
+        }
+
+        // Starts the coroutine, which resumes the awaiting coroutine once it finishes
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+        {
+            handle_.promise().continuation_ = awaiting;
+            return handle_;
+        }
+
+        T await_resume()
+        {
+            return handle_.promise().result();
+        }
+
+    private:
+        friend promise_type;
+
+        explicit Task(std::coroutine_handle<promise_type> handle)
+            : handle_(handle)
+        {
+        }
+
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    namespace internal {
+
+        template <typename T>
+        class TaskPromiseBase
+        {
+        public:
+            // Resumes the awaiting coroutine, if any, once this one finishes
+            struct FinalAwaiter
+            {
+                [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+                {
+                    if (auto continuation = handle.promise().continuation_)
+                        return continuation;
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            FinalAwaiter final_suspend() const noexcept { return {}; }
+
+            void unhandled_exception() noexcept
+            {
+                result_.template emplace<2>(std::current_exception());
+            }
+
+        protected:
+            friend Task<T>;
+
+            using result_type = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+            T result()
+            {
+                if (auto* exception = std::get_if<2>(&result_); exception != nullptr)
+                    std::rethrow_exception(*exception);
+
+                if constexpr (!std::is_void_v<T>)
+                    return std::get<1>(std::move(result_));
+            }
+
+            // Not yet finished, returned value, or exception
+            std::variant<std::monostate, result_type, std::exception_ptr> result_;
+            std::coroutine_handle<> continuation_;
+        };
+
+        template <typename T>
+        class TaskPromise : public TaskPromiseBase<T>
+        {
+        public:
+            Task<T> get_return_object() noexcept
+            {
+                return Task<T>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+            }
+
+            template <typename U = T>
+            void return_value(U&& value)
+            {
+                this->result_.template emplace<1>(std::forward<U>(value));
+            }
+        };
+
+        template <>
+        class TaskPromise<void> : public TaskPromiseBase<void>
+        {
+        public:
+            Task<void> get_return_object() noexcept
+            {
+                return Task<void>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+            }
+
+            void return_void() noexcept
+            {
+            }
+        };
+
+        // A fire-and-forget coroutine type. The coroutine starts eagerly and
+        // its frame is destroyed automatically once the coroutine finishes.
+        // The coroutine body is expected to handle all exceptions itself.
+        struct DetachedTask
+        {
+            struct promise_type
+            {
+                DetachedTask get_return_object() const noexcept { return {}; }
+                std::suspend_never initial_suspend() const noexcept { return {}; }
+                std::suspend_never final_suspend() const noexcept { return {}; }
+                void return_void() const noexcept {}
+                void unhandled_exception() const noexcept { std::terminate(); }
+            };
+        };
+
+    } // namespace internal
+
+} // namespace sdbus
+
+#endif // __cpp_lib_coroutine
+
+#endif // SDBUS_CXX_TASK_H_
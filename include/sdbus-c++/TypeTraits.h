@@ -67,6 +67,7 @@ namespace sdbus {
     class PropertySetCall;
     class PropertyGetReply;
     template <typename... Results> class Result;
+    template <typename T = void> class Task;
     class Error;
     template <typename T, typename Enable = void> struct signature_of;
 } // namespace sdbus
@@ -246,6 +247,10 @@ namespace sdbus {
         static constexpr bool is_trivial_dbus_type = false;
     };
 
+    template <typename Allocator>
+    struct signature_of<std::basic_string<char, std::char_traits<char>, Allocator>> : signature_of<std::string>
+    {};
+
     template <>
     struct signature_of<std::string_view> : signature_of<std::string>
     {};
@@ -288,6 +293,19 @@ namespace sdbus {
         static constexpr bool is_trivial_dbus_type = false;
     };
 
+    // Struct of trivial D-Bus types (or of such structs), i.e. a fixed-size record like `(ii)` or `(dd)`
+    template <typename T>
+    struct is_fixed_size_dbus_struct : std::false_type
+    {};
+
+    template <typename... ValueTypes>
+    struct is_fixed_size_dbus_struct<Struct<ValueTypes...>>
+        : std::bool_constant<((signature_of<ValueTypes>::is_trivial_dbus_type || is_fixed_size_dbus_struct<ValueTypes>::value) && ...)>
+    {};
+
+    template <typename T>
+    constexpr auto is_fixed_size_dbus_struct_v = is_fixed_size_dbus_struct<T>::value;
+
     template <>
     struct signature_of<Variant>
     {
@@ -412,6 +430,9 @@ namespace sdbus {
 
         static constexpr std::size_t arity = sizeof...(Args);
 
+        // Arguments may be moved into the function unless it takes some of them by non-const lvalue reference
+        static constexpr bool accepts_moved_arguments = !((std::is_lvalue_reference_v<Args> && !std::is_const_v<std::remove_reference_t<Args>>) || ...);
+
 //        template <size_t _Idx, typename _Enabled = void>
 //        struct arg;
 //
@@ -441,6 +462,15 @@ namespace sdbus {
     struct function_traits<ReturnType(Args...)> : function_traits_base<ReturnType, Args...>
     {
         static constexpr bool is_async = false;
+        static constexpr bool is_coroutine = false;
+        static constexpr bool has_error_param = false;
+    };
+
+    template <typename ReturnType, typename... Args>
+    struct function_traits<Task<ReturnType>(Args...)> : function_traits_base<ReturnType, Args...>
+    {
+        static constexpr bool is_async = false;
+        static constexpr bool is_coroutine = true;
         static constexpr bool has_error_param = false;
     };
 
@@ -466,6 +496,7 @@ namespace sdbus {
     struct function_traits<void(Result<Results...>, Args...)> : function_traits_base<std::tuple<Results...>, Args...>
     {
         static constexpr bool is_async = true;
+        static constexpr bool is_coroutine = false;
         using async_result_t = Result<Results...>;
     };
 
@@ -473,6 +504,7 @@ namespace sdbus {
     struct function_traits<void(Result<Results...>&&, Args...)> : function_traits_base<std::tuple<Results...>, Args...>
     {
         static constexpr bool is_async = true;
+        static constexpr bool is_coroutine = false;
         using async_result_t = Result<Results...>;
     };
 
@@ -511,6 +543,9 @@ namespace sdbus {
     template <class Function>
     constexpr auto is_async_method_v = function_traits<Function>::is_async;
 
+    template <class Function>
+    constexpr auto is_coroutine_method_v = function_traits<Function>::is_coroutine;
+
     template <class Function>
     constexpr auto has_error_param_v = function_traits<Function>::has_error_param;
 
@@ -526,6 +561,9 @@ namespace sdbus {
     template <typename FunctionType>
     using function_result_t = typename function_traits<FunctionType>::result_type;
 
+    template <typename FunctionType>
+    constexpr auto accepts_moved_arguments_v = function_traits<FunctionType>::accepts_moved_arguments;
+
     template <typename Function>
     struct tuple_of_function_input_arg_types
     {
@@ -634,6 +672,27 @@ namespace sdbus {
 
     namespace detail
     {
+        template <typename Allocator>
+        constexpr bool is_std_allocator_v = false;
+
+        template <typename T>
+        constexpr bool is_std_allocator_v<std::allocator<T>> = true;
+
+        // Constructs an object using given allocator if the object is allocator-aware (e.g. a std::pmr
+        // string or container), so that nested objects end up in the same memory as their container
+        template <typename T, typename Allocator>
+        T make_with_allocator(const Allocator& allocator)
+        {
+            if constexpr (is_std_allocator_v<Allocator>)
+                return T{}; // Stateless default allocation, nothing to pass on
+            else if constexpr (std::uses_allocator_v<T, Allocator> && std::is_constructible_v<T, std::allocator_arg_t, const Allocator&>)
+                return T(std::allocator_arg, allocator);
+            else if constexpr (std::uses_allocator_v<T, Allocator> && std::is_constructible_v<T, const Allocator&>)
+                return T(allocator);
+            else
+                return T{};
+        }
+
         template <class Function, class Tuple, typename... Args, std::size_t... I>
         constexpr decltype(auto) apply_impl( Function&& fun
                                            , Result<Args...>&& res
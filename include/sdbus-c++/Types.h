@@ -34,17 +34,54 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <variant>
 
 namespace sdbus {
 
+    namespace detail
+    {
+        // Basic D-Bus types (all except unix fd) whose values Variant holds in compact storage
+        constexpr bool is_compact_variant_type(char type)
+        {
+            return type != '\0' && std::string_view{"ybnqiuxtdsog"}.find(type) != std::string_view::npos;
+        }
+
+        // D-Bus type of a Variant value of given C++ type if it goes to compact storage, '\0' otherwise
+        template <typename ValueType>
+        constexpr char compact_variant_type_of()
+        {
+            if constexpr (signature_of<ValueType>::is_valid && signature_of_v<ValueType>.size() == 1)
+                return is_compact_variant_type(signature_of_v<ValueType>[0]) ? signature_of_v<ValueType>[0] : '\0';
+            else
+                return '\0';
+        }
+
+        // C++ representation of a compact Variant value of given D-Bus type
+        template <char Type> struct compact_variant_value { using type = std::string; }; // s, o, g
+        template <> struct compact_variant_value<'y'> { using type = uint8_t; };
+        template <> struct compact_variant_value<'b'> { using type = bool; };
+        template <> struct compact_variant_value<'n'> { using type = int16_t; };
+        template <> struct compact_variant_value<'q'> { using type = uint16_t; };
+        template <> struct compact_variant_value<'i'> { using type = int32_t; };
+        template <> struct compact_variant_value<'u'> { using type = uint32_t; };
+        template <> struct compact_variant_value<'x'> { using type = int64_t; };
+        template <> struct compact_variant_value<'t'> { using type = uint64_t; };
+        template <> struct compact_variant_value<'d'> { using type = double; };
+    } // namespace detail
+
     /********************************************//**
      * @class Variant
      *
      * Variant can hold value of any D-Bus-supported type.
      *
+     * Values of basic D-Bus types (except unix fds) are stored compactly, directly
+     * in the Variant object. Values of other types are stored serialized in an
+     * underlying plain D-Bus message, which is shared by copies of the Variant.
+     *
      * Note: Even though thread-aware, Variant objects are not thread-safe.
      * Some const methods are conceptually const, but not physically const,
      * thus are not thread-safe. This is by design: normally, clients
@@ -56,17 +93,32 @@ namespace sdbus {
     {
     public:
         Variant();
+        Variant(const Variant&) = default;
+        Variant& operator=(const Variant&) = default;
+        Variant(Variant&& other) noexcept;
+        Variant& operator=(Variant&& other) noexcept;
+        ~Variant() = default;
 
         template <typename ValueType>
-        explicit Variant(const ValueType& value) : Variant()
+        explicit Variant(const ValueType& value)
         {
-            msg_.openVariant<ValueType>();
-            msg_ << value;
-            msg_.closeVariant();
-            msg_.seal();
+            if constexpr (constexpr auto type = detail::compact_variant_type_of<ValueType>(); type != '\0')
+            {
+                compactValue_ = static_cast<typename detail::compact_variant_value<type>::type>(value);
+                compactType_ = type;
+            }
+            else
+            {
+                msg_ = createPlainMessage();
+                msg_.openVariant<ValueType>();
+                msg_ << value;
+                msg_.closeVariant();
+                msg_.seal();
+            }
         }
 
-        Variant(const Variant& value, embed_variant_t) : Variant()
+        Variant(const Variant& value, embed_variant_t)
+            : msg_(createPlainMessage())
         {
             msg_.openVariant<Variant>();
             msg_ << value;
@@ -75,7 +127,8 @@ namespace sdbus {
         }
 
         template <typename Struct>
-        explicit Variant(const as_dictionary<Struct>& value) : Variant()
+        explicit Variant(const as_dictionary<Struct>& value)
+            : msg_(createPlainMessage())
         {
             msg_.openVariant<std::map<std::string, Variant>>();
             msg_ << as_dictionary(value.m_struct);
@@ -85,7 +138,7 @@ namespace sdbus {
 
         template <typename... Elements>
         Variant(const std::variant<Elements...>& value) // NOLINT(google-explicit-constructor,hicpp-explicit-conversions): implicit conversion intentional
-            : Variant()
+            : msg_(createPlainMessage())
         {
             msg_ << value;
             msg_.seal();
@@ -94,6 +147,19 @@ namespace sdbus {
         template <typename ValueType>
         ValueType get() const
         {
+            if constexpr (constexpr auto type = detail::compact_variant_type_of<ValueType>(); type != '\0')
+            {
+                if (compactType_ == type)
+                {
+                    const auto& value = std::get<typename detail::compact_variant_value<type>::type>(compactValue_);
+                    if constexpr (std::is_same_v<ValueType, const char*>)
+                        return value.c_str();
+                    else if constexpr (std::is_constructible_v<ValueType, decltype(value)>)
+                        return ValueType(value);
+                }
+            }
+
+            ensureMessage();
             msg_.rewind(false);
 
             msg_.enterVariant<ValueType>();
@@ -103,8 +169,35 @@ namespace sdbus {
             return val;
         }
 
+        // Allocator-aware values (e.g. std::pmr strings and containers) are created with the given allocator
+        template <typename ValueType, typename Allocator>
+        ValueType get(const Allocator& allocator) const
+        {
+            if constexpr (constexpr auto type = detail::compact_variant_type_of<ValueType>(); type != '\0')
+            {
+                if (compactType_ == type)
+                {
+                    const auto& value = std::get<typename detail::compact_variant_value<type>::type>(compactValue_);
+                    if constexpr (std::uses_allocator_v<ValueType, Allocator> && std::is_constructible_v<ValueType, decltype(value), const Allocator&>)
+                        return ValueType(value, allocator);
+                    else if constexpr (std::is_constructible_v<ValueType, decltype(value)>)
+                        return ValueType(value);
+                }
+            }
+
+            ensureMessage();
+            msg_.rewind(false);
+
+            msg_.enterVariant<ValueType>();
+            auto val = detail::make_with_allocator<ValueType>(allocator);
+            msg_ >> val;
+            msg_.exitVariant();
+            return val;
+        }
+
         [[nodiscard]] std::string dumpToString() const
         {
+            ensureMessage();
             msg_.rewind(false);
 
             return msg_.dumpToString(Message::DumpFlags::SubtreeOnly);
@@ -122,6 +215,7 @@ namespace sdbus {
         operator std::variant<Elements...>() const // NOLINT(google-explicit-constructor,hicpp-explicit-conversions): implicit conversion intentional
         {
             std::variant<Elements...> result;
+            ensureMessage();
             msg_.rewind(false);
             msg_ >> result;
             return result;
@@ -141,6 +235,13 @@ namespace sdbus {
         const char* peekValueType() const;
 
     private:
+        // Creates the underlying message from the compact value, if not done yet
+        void ensureMessage() const;
+        void serializeCompactValueTo(Message& msg) const;
+        void deserializeCompactValueFrom(Message& msg, char type);
+
+        std::variant<std::monostate, bool, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t, double, std::string> compactValue_;
+        char compactType_{}; // D-Bus type of the compact value, '\0' if the value is in the message (or the variant is empty)
         mutable PlainMessage msg_;
     };
 
@@ -425,6 +526,11 @@ template <typename... ValueTypes>
 struct std::tuple_size<sdbus::Struct<ValueTypes...>> // NOLINT(cert-dcl58-cpp): specialization in std namespace allowed in this case
     : std::tuple_size<std::tuple<ValueTypes...>>
 {};
+// Struct with allocator-aware members (e.g. std::pmr strings) passes the allocator of its container on to them
+template <typename... ValueTypes, typename Allocator>
+struct std::uses_allocator<sdbus::Struct<ValueTypes...>, Allocator> // NOLINT(cert-dcl58-cpp): specialization in std namespace allowed in this case
+    : std::disjunction<std::uses_allocator<ValueTypes, Allocator>...>
+{};
 
 // NOLINTBEGIN(cppcoreguidelines-macro-usage)
 
@@ -27,14 +27,74 @@
 #define SDBUS_CPP_VTABLEITEMS_INL_
 
 #include <sdbus-c++/Error.h>
+#include <sdbus-c++/MessageArena.h>
+#include <sdbus-c++/Task.h>
 #include <sdbus-c++/TypeTraits.h>
 
+#include <exception>
+#include <optional>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <vector>
 
 namespace sdbus {
 
+#ifdef __cpp_lib_coroutine
+    namespace internal {
+
+        // Runs a Task-returning method handler to completion and sends back its result (or error) as the method reply.
+        // Input arguments live in the frame of this coroutine, so the handler may safely take them by reference.
+        // The method call message is kept here as well, so string views borrowed from it stay valid, too.
+        template <typename Function, typename InputArgs>
+        DetachedTask invokeMethodCoroutine(const Function& callback, MethodCall call, InputArgs inputArgs)
+        {
+            std::optional<Error> error;
+
+            try
+            {
+                if constexpr (std::is_void_v<function_result_t<Function>>)
+                {
+                    co_await std::apply(callback, HandlerArenaScope<Function, false>::forwardArguments(inputArgs));
+                    call.createReply().send();
+                }
+                else
+                {
+                    auto ret = co_await std::apply(callback, HandlerArenaScope<Function, false>::forwardArguments(inputArgs));
+                    auto reply = call.createReply();
+                    reply << ret;
+                    reply.send();
+                }
+            }
+            catch (const Error& e)
+            {
+                error = e;
+            }
+            catch (const std::exception& e)
+            {
+                error = Error(SDBUSCPP_ERROR_NAME, e.what());
+            }
+            catch (...)
+            {
+                error = Error(SDBUSCPP_ERROR_NAME, "Unknown error occurred");
+            }
+
+            if (!error)
+                co_return;
+
+            try
+            {
+                call.createErrorReply(*error).send();
+            }
+            catch (...) // NOLINT(bugprone-empty-catch)
+            {
+                // There is nobody to report the failure to; the caller will eventually time out
+            }
+        }
+
+    } // namespace internal
+#endif // __cpp_lib_coroutine
+
     /*** -------------------- ***/
     /***  Method VTable Item  ***/
     /*** -------------------- ***/
@@ -48,15 +108,25 @@ namespace sdbus {
         {
             // Create a tuple of callback input arguments' types, which will be used
             // as a storage for the argument values deserialized from the message.
-            tuple_of_function_input_arg_types_t<Function> inputArgs;
+            // Allocator-aware arguments of synchronous handlers live in the handler arena.
+            using ArenaScope = internal::HandlerArenaScope<Function, !is_async_method_v<Function> && !is_coroutine_method_v<Function>>;
+            const ArenaScope arenaScope;
+            auto inputArgs = arenaScope.makeArguments();
 
             // Deserialize input arguments from the message into the tuple.
             call >> inputArgs;
 
-            if constexpr (!is_async_method_v<Function>)
+            if constexpr (is_coroutine_method_v<Function>)
+            {
+#ifdef __cpp_lib_coroutine
+                // Run the coroutine, which sends the reply back once it finishes, possibly after this function has returned.
+                internal::invokeMethodCoroutine(callback, std::move(call), std::move(inputArgs));
+#endif // __cpp_lib_coroutine
+            }
+            else if constexpr (!is_async_method_v<Function>)
             {
-                // Invoke callback with input arguments from the tuple.
-                auto ret = sdbus::apply(callback, inputArgs);
+                // Invoke callback with input arguments from the tuple, moving them into by-value and rvalue reference parameters.
+                auto ret = sdbus::apply(callback, ArenaScope::forwardArguments(inputArgs));
 
                 // Store output arguments to the reply message and send it back.
                 auto reply = call.createReply();
@@ -67,7 +137,7 @@ namespace sdbus {
             {
                 // Invoke callback with input arguments from the tuple and with result object to be set later
                 using AsyncResult = typename function_traits<Function>::async_result_t;
-                sdbus::apply(callback, AsyncResult{std::move(call)}, std::move(inputArgs));
+                sdbus::apply(callback, AsyncResult{std::move(call)}, ArenaScope::forwardArguments(inputArgs));
             }
         };
 
@@ -32,9 +32,14 @@
 #include <sdbus-c++/ProxyInterfaces.h>
 #include <sdbus-c++/StandardInterfaces.h>
 #include <sdbus-c++/Message.h>
+#include <sdbus-c++/MessageArena.h>
+#include <sdbus-c++/MemfdArray.h>
 #include <sdbus-c++/MethodResult.h>
+#include <sdbus-c++/Reactor.h>
+#include <sdbus-c++/Task.h>
 #include <sdbus-c++/Types.h>
 #include <sdbus-c++/TypeTraits.h>
 #include <sdbus-c++/Error.h>
+#include <sdbus-c++/Executor.h>
 #include <sdbus-c++/Flags.h>
 // IWYU pragma: end_exports
@@ -37,16 +37,22 @@
 #include "ScopeGuard.h"
 #include "SdBus.h"
 #include "Utils.h"
+#include "WorkerPool.h"
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cassert>
 #include <cerrno>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <ctime>
+#include <functional>
 #include <memory>
 #include <poll.h>
 #include <string>
+#include <string_view>
 #include <sys/eventfd.h>
 #include SDBUS_HEADER
 #ifndef SDBUS_basu // sd_event integration is not supported in basu-based sdbus-c++
@@ -154,6 +160,98 @@ void Connection::releaseName(const ServiceName& name)
     wakeUpEventLoopIfMessagesInQueue();
 }
 
+void Connection::enableMultithreadedDispatch(std::size_t workerCount, DispatchOrdering ordering)
+{
+    SDBUS_THROW_ERROR_IF(dispatchWorkers_ != nullptr, "Multi-threaded dispatch has already been enabled", EALREADY);
+
+    dispatchWorkers_ = std::make_unique<WorkerPool>(workerCount);
+    dispatchOrdering_ = ordering;
+}
+
+Slot Connection::startBatch()
+{
+    // The bus lock is held for the whole batch, and released in finishBatch()
+    std::unique_lock lock(*sdbus_);
+
+    if (batchDepth_ == 0)
+    {
+        batchPollTimeout_ = getEventLoopPollData().timeout;
+        batchThreadId_ = std::this_thread::get_id();
+    }
+    ++batchDepth_;
+
+    lock.release();
+
+    return {this, [this](void* /*batch*/){ finishBatch(); }};
+}
+
+void Connection::finishBatch() noexcept
+{
+    const std::unique_lock lock(*sdbus_, std::adopt_lock);
+
+    assert(batchDepth_ > 0);
+    if (--batchDepth_ > 0)
+        return;
+
+    batchThreadId_ = std::thread::id{};
+
+    try
+    {
+        // The same as in callMethodAsync(), but evaluated only once for all messages of the batch
+        if (getEventLoopPollData().timeout < batchPollTimeout_ || arePendingMessagesInQueues())
+            notifyEventLoopToWakeUpFromPoll();
+    }
+    catch (const Error&)
+    {
+        // Rather wake the event loop up needlessly than leave it sleeping with stale poll data
+        (void)eventfd_write(eventFd_.fd, 1);
+    }
+}
+
+bool Connection::isBatchInProgressInThisThread() const
+{
+    return batchThreadId_.load() == std::this_thread::get_id();
+}
+
+void Connection::enableIoUringEventLoop()
+{
+    SDBUS_THROW_ERROR_IF(ioUringPoller_ != nullptr, "io_uring event loop has already been enabled", EALREADY);
+    SDBUS_THROW_ERROR_IF(eventLoopThreadId_.load() != std::thread::id{}, "Event loop is already running", EBUSY);
+
+    ioUringPoller_ = std::make_unique<IoUringPoller>(eventFd_.fd, loopExitFd_.fd);
+}
+
+void Connection::enableSignalDemultiplexing(const ObjectPath& pathNamespace)
+{
+    SDBUS_CHECK_OBJECT_PATH(pathNamespace.c_str());
+    SDBUS_THROW_ERROR_IF(!signalDemuxNamespace_.empty(), "Signal demultiplexing has already been enabled", EALREADY);
+
+    signalDemuxNamespace_ = pathNamespace;
+}
+
+Connection::Metrics Connection::getMetrics() const
+{
+    Metrics metrics;
+
+    auto r = sdbus_->sd_bus_get_n_queued(bus_.get(), &metrics.readQueueSize, &metrics.writeQueueSize);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to get number of pending messages in sd-bus queues", -r);
+
+    metrics.processedMessages = metrics_.processedMessages.load(std::memory_order_relaxed);
+    metrics.pendingAsyncCalls = metrics_.pendingAsyncCalls.load(std::memory_order_relaxed);
+    metrics.matchRules = metrics_.matchRules.load(std::memory_order_relaxed);
+    metrics.dispatchTime = std::chrono::nanoseconds{metrics_.dispatchTimeNs.load(std::memory_order_relaxed)};
+    metrics.pollTime = std::chrono::nanoseconds{metrics_.pollTimeNs.load(std::memory_order_relaxed)};
+    for (std::size_t i = 0; i < Metrics::DISPATCH_TIME_HISTOGRAM_SIZE; ++i)
+        metrics.dispatchTimeHistogram[i] = metrics_.dispatchTimeHistogram[i].load(std::memory_order_relaxed);
+
+    return metrics;
+}
+
+void Connection::enableTimingMetrics()
+{
+    metrics_.timingEnabled.store(true, std::memory_order_relaxed);
+}
+
 BusName Connection::getUniqueName() const
 {
     const char* name{};
@@ -164,6 +262,17 @@ BusName Connection::getUniqueName() const
 
 void Connection::enterEventLoop()
 {
+    eventLoopThreadId_ = std::this_thread::get_id();
+    SCOPE_EXIT
+    {
+        eventLoopThreadId_ = std::thread::id{};
+        // Nobody would deliver replies to synchronous calls awaited in other threads anymore
+        abortPendingSyncCalls();
+    };
+
+    if (ioUringPoller_ != nullptr)
+        return runIoUringEventLoop();
+
     while (true)
     {
         // Process one pending event
@@ -177,6 +286,36 @@ void Connection::enterEventLoop()
     }
 }
 
+void Connection::runIoUringEventLoop()
+{
+    // How many messages at most to process before checking for the loop exit notification
+    constexpr unsigned int maxEventsPerWakeUp{64};
+
+    auto *bus = bus_.get();
+    assert(bus != nullptr);
+
+    while (true)
+    {
+        // Unlike the poll() based loop, we process pending events in one go, without going to the kernel
+        // between two messages. Processing the event fd notifications is up to the poller.
+        (void)processDueTimers();
+        for (unsigned int i = 0; i < maxEventsPerWakeUp; ++i)
+        {
+            const int r = processBus(bus);
+            SDBUS_THROW_ERROR_IF(r < 0, "Failed to process bus requests", -r);
+            if (r == 0)
+                break;
+        }
+
+        auto sdbusPollData = getEventLoopPollData();
+        const auto pollStart = startTimingMeasurement();
+        auto success = ioUringPoller_->wait(sdbusPollData.fd, sdbusPollData.events, sdbusPollData.getRelativeTimeout());
+        addPollTime(pollStart);
+        if (!success)
+            break; // Exit I/O event loop
+    }
+}
+
 void Connection::enterEventLoopAsync()
 {
     if (!asyncLoopThread_.joinable())
@@ -199,6 +338,13 @@ Connection::PollData Connection::getEventLoopPollData() const
 
     auto timeout = pollData.timeout_usec == UINT64_MAX ? std::chrono::microseconds::max() : std::chrono::microseconds(pollData.timeout_usec);
 
+    if (armedTimerCount_ > 0)
+    {
+        std::lock_guard lock(timersMutex_);
+        for (const auto* timer : timers_)
+            timeout = std::min(timeout, timer->deadline);
+    }
+
     return {pollData.fd, pollData.events, timeout, eventFd_.fd};
 }
 
@@ -253,7 +399,7 @@ Slot Connection::addMatch(const std::string& match, message_handler callback, re
     auto r = sdbus_->sd_bus_add_match(bus_.get(), &slot, match.c_str(), &Connection::sdbus_match_callback, matchInfo.get());
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to add match", -r);
 
-    matchInfo->slot = {slot, [this](void *slot){ sdbus_->sd_bus_slot_unref(static_cast<sd_bus_slot*>(slot)); }};
+    matchInfo->slot = makeCountedSlot(slot, metrics_.matchRules);
 
     return {matchInfo.release(), [](void *ptr){ delete static_cast<MatchInfo*>(ptr); }}; // NOLINT(cppcoreguidelines-owning-memory)
 }
@@ -282,7 +428,7 @@ Slot Connection::addMatchAsync( const std::string& match
                                            , matchInfo.get());
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to add match", -r);
 
-    matchInfo->slot = {slot, [this](void *slot){ sdbus_->sd_bus_slot_unref(static_cast<sd_bus_slot*>(slot)); }};
+    matchInfo->slot = makeCountedSlot(slot, metrics_.matchRules);
 
     return {matchInfo.release(), [](void *ptr){ delete static_cast<MatchInfo*>(ptr); }}; // NOLINT(cppcoreguidelines-owning-memory)
 }
@@ -624,6 +770,9 @@ Slot Connection::registerSignalHandler( const char* sender
                                       , void* userData
                                       , return_slot_t )
 {
+    if (*interfaceName != '\0' && *signalName != '\0' && isInSignalDemultiplexingNamespace(objectPath))
+        return registerDemultiplexedSignalHandler(sender, objectPath, interfaceName, signalName, callback, userData);
+
     sd_bus_slot *slot{};
 
     auto r = sdbus_->sd_bus_match_signal( bus_.get()
@@ -637,7 +786,93 @@ Slot Connection::registerSignalHandler( const char* sender
 
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to register signal handler", -r);
 
-    return {slot, [this](void *slot){ sdbus_->sd_bus_slot_unref(static_cast<sd_bus_slot*>(slot)); }};
+    return makeCountedSlot(slot, metrics_.matchRules);
+}
+
+bool Connection::isInSignalDemultiplexingNamespace(const char* objectPath) const
+{
+    if (signalDemuxNamespace_.empty() || *objectPath == '\0')
+        return false;
+
+    const std::string_view path{objectPath};
+    if (signalDemuxNamespace_ == "/")
+        return true;
+
+    return path.starts_with(signalDemuxNamespace_)
+        && (path.size() == signalDemuxNamespace_.size() || path[signalDemuxNamespace_.size()] == '/');
+}
+
+Slot Connection::registerDemultiplexedSignalHandler( const char* sender
+                                                   , const char* objectPath
+                                                   , const char* interfaceName
+                                                   , const char* signalName
+                                                   , sd_bus_message_handler_t callback
+                                                   , void* userData )
+{
+    // The bus lock also serializes us with the dispatch of incoming signals, which runs under the lock
+    const std::lock_guard lock(*sdbus_);
+
+    auto& match = signalMatches_[sender];
+    if (match == nullptr)
+    {
+        auto newMatch = std::make_unique<SignalMatch>(SignalMatch{*this, sender, {}, {}, {}});
+
+        std::string matchRule = "type='signal',";
+        if (*sender != '\0')
+            matchRule += "sender='" + std::string{sender} + "',";
+        matchRule += "path_namespace='" + signalDemuxNamespace_ + "'";
+
+        sd_bus_slot *slot{};
+        auto r = sdbus_->sd_bus_add_match(bus_.get(), &slot, matchRule.c_str(), &Connection::sdbus_signal_demux_callback, newMatch.get());
+        if (r < 0)
+            signalMatches_.erase(sender);
+        SDBUS_THROW_ERROR_IF(r < 0, "Failed to register signal handler", -r);
+
+        newMatch->slot = makeCountedSlot(slot, metrics_.matchRules);
+        match = std::move(newMatch);
+    }
+
+    std::string key;
+    makeSignalKey(key, objectPath, interfaceName, signalName);
+    auto subscription = std::make_unique<SignalSubscription>(SignalSubscription{callback, userData});
+    match->subscriptions.emplace(key, subscription.get());
+
+    return {subscription.release(), [this, match = match.get(), key = std::move(key)](void *ptr)
+    {
+        const std::lock_guard lock(*sdbus_);
+
+        auto* subscription = static_cast<SignalSubscription*>(ptr);
+        auto range = match->subscriptions.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == subscription)
+            {
+                match->subscriptions.erase(it);
+                break;
+            }
+        }
+        delete subscription; // NOLINT(cppcoreguidelines-owning-memory)
+
+        // If the match is in the middle of dispatching, it gets removed once the dispatching is done
+        if (match->subscriptions.empty() && !match->dispatching)
+            removeSignalMatch(*match);
+    }};
+}
+
+void Connection::removeSignalMatch(SignalMatch& match)
+{
+    auto it = signalMatches_.find(match.sender);
+    assert(it != signalMatches_.end() && it->second.get() == &match);
+    signalMatches_.erase(it);
+}
+
+void Connection::makeSignalKey(std::string& key, const char* objectPath, const char* interfaceName, const char* signalName)
+{
+    key.assign(objectPath);
+    key.push_back('\0');
+    key.append(interfaceName);
+    key.push_back('\0');
+    key.append(signalName);
 }
 
 sd_bus_message* Connection::incrementMessageRefCount(sd_bus_message* sdbusMsg)
@@ -667,11 +902,24 @@ sd_bus_creds* Connection::decrementCredsRefCount(sd_bus_creds* creds)
 
 sd_bus_message* Connection::callMethod(sd_bus_message* sdbusMsg, uint64_t timeout)
 {
+    // If the event loop runs in another thread, we let it pick up the reply, so that the connection keeps
+    // serving other messages (including replies to concurrent synchronous calls from other threads) meanwhile.
+    // A batch in this thread holds the bus lock though, so the event loop couldn't pick up anything.
+    if (!isBatchInProgressInThisThread())
+    {
+        PendingSyncCall call{.connection = *this, .mutex = {}, .cond = {}};
+        if (registerPendingSyncCall(call))
+        {
+            SCOPE_EXIT{ unregisterPendingSyncCall(call); };
+            return callMethodThroughEventLoop(call, sdbusMsg, timeout);
+        }
+    }
+
     sd_bus_error sdbusError = SD_BUS_ERROR_NULL;
     SCOPE_EXIT{ sd_bus_error_free(&sdbusError); };
 
-    // This call will block the bus connection from serving other messages
-    // until the reply arrives or the call times out.
+    // Otherwise (no event loop, an external event loop, or a call made from within the event loop thread),
+    // this call will block the bus connection from serving other messages until the reply arrives or the call times out.
     sd_bus_message* sdbusReply{};
     auto r = sdbus_->sd_bus_call(nullptr, sdbusMsg, timeout, &sdbusError, &sdbusReply);
 
@@ -687,10 +935,103 @@ sd_bus_message* Connection::callMethod(sd_bus_message* sdbusMsg, uint64_t timeou
     return sdbusReply;
 }
 
+bool Connection::isEventLoopRunningInAnotherThread() const
+{
+    auto eventLoopThreadId = eventLoopThreadId_.load();
+    return eventLoopThreadId != std::thread::id{} && eventLoopThreadId != std::this_thread::get_id();
+}
+
+bool Connection::registerPendingSyncCall(PendingSyncCall& call)
+{
+    // The event loop clears its thread id before aborting pending calls under the same mutex,
+    // so a call registered here is either served by the loop or aborted upon its exit.
+    const std::lock_guard lock(pendingSyncCallsMutex_);
+    if (!isEventLoopRunningInAnotherThread())
+        return false;
+
+    pendingSyncCalls_.push_back(&call);
+    return true;
+}
+
+void Connection::unregisterPendingSyncCall(PendingSyncCall& call)
+{
+    const std::lock_guard lock(pendingSyncCallsMutex_);
+    std::erase(pendingSyncCalls_, &call);
+}
+
+void Connection::abortPendingSyncCalls()
+{
+    const std::lock_guard lock(pendingSyncCallsMutex_);
+    for (auto* call : pendingSyncCalls_)
+    {
+        const std::lock_guard callLock(call->mutex);
+        call->aborted = true;
+        call->cond.notify_one();
+    }
+}
+
+sd_bus_message* Connection::callMethodThroughEventLoop(PendingSyncCall& call, sd_bus_message* sdbusMsg, uint64_t timeout)
+{
+    // The reply (or the timeout error reply synthesized by sd-bus) gets delivered by the event loop, and we get
+    // woken up should the event loop exit in the meantime. We still keep an explicit deadline on our own side.
+    // The default timeout (0) is not resolved here, though, as older libsystemd versions can't report it.
+    auto slot = callMethodAsync(sdbusMsg, &Connection::sdbus_sync_call_reply_callback, &call, timeout, return_slot);
+
+    auto isDone = [&call](){ return call.reply != nullptr || call.aborted; };
+    std::unique_lock lock(call.mutex);
+    if (timeout == 0 || timeout == UINT64_MAX)
+        call.cond.wait(lock, isDone);
+    else
+        (void)call.cond.wait_for(lock, std::chrono::microseconds(timeout), isDone);
+    lock.unlock();
+
+    // Unregisters the reply callback, so it can't access `call' anymore
+    slot.reset();
+
+    // The reply may have been delivered between the end of the wait and the unregistration of the callback
+    lock.lock();
+    auto* sdbusReply = std::exchange(call.reply, nullptr);
+    auto aborted = call.aborted;
+    lock.unlock();
+
+    SDBUS_THROW_ERROR_IF(sdbusReply == nullptr && aborted, "Failed to call method: event loop exited before the reply arrived", ECANCELED);
+    SDBUS_THROW_ERROR_IF(sdbusReply == nullptr, "Failed to call method", ETIMEDOUT);
+
+    if (sd_bus_message_is_method_error(sdbusReply, nullptr) > 0)
+    {
+        SCOPE_EXIT{ decrementMessageRefCount(sdbusReply); };
+        const auto* sdbusError = sd_bus_message_get_error(sdbusReply);
+        throw Error(Error::Name{sdbusError->name}, sdbusError->message);
+    }
+
+    return sdbusReply;
+}
+
+int Connection::sdbus_sync_call_reply_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error */*retError*/)
+{
+    auto* call = static_cast<PendingSyncCall*>(userData);
+    assert(call != nullptr);
+
+    const std::lock_guard lock(call->mutex);
+    call->reply = call->connection.incrementMessageRefCount(sdbusMessage);
+    call->cond.notify_one();
+
+    return 1;
+}
+
 Slot Connection::callMethodAsync(sd_bus_message* sdbusMsg, sd_bus_message_handler_t callback, void* userData, uint64_t timeout, return_slot_t)
 {
     sd_bus_slot *slot{};
 
+    // Within a batch, the bus is locked already and the event loop gets woken up, if needed, at the end of the batch
+    if (isBatchInProgressInThisThread())
+    {
+        auto r = sdbus_->sd_bus_call_async(nullptr, &slot, sdbusMsg, callback, userData, timeout);
+        SDBUS_THROW_ERROR_IF(r < 0, "Failed to call method asynchronously", -r);
+
+        return makeCountedSlot(slot, metrics_.pendingAsyncCalls);
+    }
+
     // TODO: Think of ways of optimizing these three locking/unlocking of sdbus mutex (merge into one call?)
     auto timeoutBefore = getEventLoopPollData().timeout;
     auto r = sdbus_->sd_bus_call_async(nullptr, &slot, sdbusMsg, callback, userData, timeout);
@@ -703,15 +1044,17 @@ Slot Connection::callMethodAsync(sd_bus_message* sdbusMsg, sd_bus_message_handle
     if (timeoutAfter < timeoutBefore || arePendingMessagesInQueues())
         notifyEventLoopToWakeUpFromPoll();
 
-    return {slot, [this](void *slot){ sdbus_->sd_bus_slot_unref(static_cast<sd_bus_slot*>(slot)); }};
+    return makeCountedSlot(slot, metrics_.pendingAsyncCalls);
 }
 
 void Connection::sendMessage(sd_bus_message* sdbusMsg)
 {
     auto r = sdbus_->sd_bus_send(nullptr, sdbusMsg, nullptr);
 
-    // Wake up event loop to continue dispatching the (fairly large) outbound message that hasn't yet been fully sent
-    wakeUpEventLoopIfMessagesInQueue();
+    // Wake up event loop to continue dispatching the (fairly large) outbound message that hasn't yet been fully sent.
+    // Within a batch, this is done only once, at the end of the batch.
+    if (!isBatchInProgressInThisThread())
+        wakeUpEventLoopIfMessagesInQueue();
 
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to send D-Bus message", -r);
 }
@@ -739,6 +1082,95 @@ sd_bus_message* Connection::createErrorReplyMessage(sd_bus_message* sdbusMsg, co
     return sdbusErrorReply;
 }
 
+bool Connection::dispatchesMethodCallsToWorkers() const
+{
+    return dispatchWorkers_ != nullptr;
+}
+
+void Connection::dispatchMethodCall(const MethodCall& call, std::function<void()> handler)
+{
+    assert(dispatchWorkers_ != nullptr);
+
+    const auto* orderingKey = dispatchOrdering_ == DispatchOrdering::PerSender ? call.getSender() : call.getPath();
+    const auto hash = std::hash<std::string_view>{}(orderingKey != nullptr ? orderingKey : "");
+
+    dispatchWorkers_->post(hash, std::move(handler));
+}
+
+Slot Connection::addTimer(std::chrono::microseconds delay, std::function<void()> callback)
+{
+    auto timer = std::make_unique<Timer>(Timer{std::chrono::duration_cast<std::chrono::microseconds>(now()) + delay, std::move(callback)});
+
+    {
+        std::lock_guard lock(timersMutex_);
+        timers_.push_back(timer.get());
+        ++armedTimerCount_;
+    }
+
+    // The event loop may be waiting in poll with a later timeout, so it shall re-enter poll with the new one
+    notifyEventLoopToWakeUpFromPoll();
+
+    return {timer.release(), [this](void *timer)
+    {
+        {
+            std::lock_guard lock(timersMutex_);
+            if (auto it = std::find(timers_.begin(), timers_.end(), timer); it != timers_.end())
+            {
+                timers_.erase(it);
+                --armedTimerCount_;
+            }
+        }
+
+        // Wait for the callback in case it is just running in the event loop thread. The bus lock goes first,
+        // in the same order as in processDueTimers(), as the slot may be released within a batch holding it.
+        std::lock_guard busLock(*sdbus_);
+        std::lock_guard callbackLock(timerCallbackMutex_);
+
+        // A callback of a due timer may release the slot of another timer due in the same batch
+        std::replace(firingTimers_.begin(), firingTimers_.end(), static_cast<Timer*>(timer), static_cast<Timer*>(nullptr));
+        delete static_cast<Timer*>(timer); // NOLINT(cppcoreguidelines-owning-memory)
+    }};
+}
+
+bool Connection::processDueTimers()
+{
+    if (armedTimerCount_ == 0)
+        return false;
+
+    // Held across collecting and invoking the callbacks, so that slots of timers being fired wait for their callbacks.
+    // Callbacks typically emit signals, which takes the bus lock, so the bus lock is taken first. Otherwise a thread
+    // releasing a timer slot within a batch (which holds the bus lock) and the callback would lock in opposite order.
+    std::lock_guard busLock(*sdbus_);
+    std::lock_guard callbackLock(timerCallbackMutex_);
+
+    assert(firingTimers_.empty()); // Timer callbacks don't process events themselves
+    {
+        std::lock_guard lock(timersMutex_);
+        const auto currentTime = std::chrono::duration_cast<std::chrono::microseconds>(now());
+        auto it = std::partition(timers_.begin(), timers_.end(), [currentTime](const Timer* timer){ return timer->deadline > currentTime; });
+        firingTimers_.assign(it, timers_.end());
+        timers_.erase(it, timers_.end());
+        armedTimerCount_ -= firingTimers_.size();
+    }
+    SCOPE_EXIT{ firingTimers_.clear(); };
+
+    std::sort(firingTimers_.begin(), firingTimers_.end(), [](const Timer* lhs, const Timer* rhs){ return lhs->deadline < rhs->deadline; });
+    const auto timersFired = !firingTimers_.empty();
+    for (std::size_t i = 0; i < firingTimers_.size(); ++i)
+    {
+        // Re-read on each iteration, as entries of timers whose slots got released by earlier callbacks are nulled out
+        auto* timer = firingTimers_[i];
+        if (timer == nullptr)
+            continue;
+
+        // Moved out, as the callback may destroy the slot owning the timer
+        auto callback = std::move(timer->callback);
+        callback();
+    }
+
+    return timersFired;
+}
+
 Connection::BusPtr Connection::openBus(const BusFactory& busFactory)
 {
     sd_bus* bus{};
@@ -815,7 +1247,9 @@ bool Connection::processPendingEvent()
     auto *bus = bus_.get();
     assert(bus != nullptr);
 
-    const int r = sdbus_->sd_bus_process(bus, nullptr);
+    const auto timersFired = processDueTimers();
+
+    const int r = processBus(bus);
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to process bus requests", -r);
 
     // In correct use of sdbus-c++ API, r can be 0 only when processPendingEvent()
@@ -824,7 +1258,7 @@ bool Connection::processPendingEvent()
     if (r == 0)
         eventFd_.clear();
 
-    return r > 0;
+    return r > 0 || timersFired;
 }
 
 bool Connection::waitForNextEvent() // NOLINT(misc-no-recursion)
@@ -842,7 +1276,9 @@ bool Connection::waitForNextEvent() // NOLINT(misc-no-recursion)
     // Are there pending messages in the inbound queue? Then sd-bus will set timeout to 0, so poll() will wake up right away.
     // Are there pending messages in the outbound queue? Then sd-bus will add POLLOUT to events, so poll() will wake up right away.
     auto timeout = sdbusPollData.getPollTimeout();
+    const auto pollStart = startTimingMeasurement();
     auto r = poll(fds, fdsCount, timeout);
+    addPollTime(pollStart);
 
     if (r < 0 && errno == EINTR)
         return true; // Try again
@@ -879,6 +1315,57 @@ bool Connection::arePendingMessagesInQueues() const
     return readQueueSize > 0 || writeQueueSize > 0;
 }
 
+int Connection::processBus(sd_bus* bus)
+{
+    const auto start = startTimingMeasurement();
+
+    const int r = sdbus_->sd_bus_process(bus, nullptr);
+    if (r <= 0)
+        return r; // Nothing processed, so nothing to count
+
+    metrics_.processedMessages.fetch_add(1, std::memory_order_relaxed);
+    if (start != std::chrono::steady_clock::time_point{})
+    {
+        const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        metrics_.dispatchTimeNs.fetch_add(static_cast<uint64_t>(time.count()), std::memory_order_relaxed);
+
+        // Bucket 0 is for times below 1us, bucket i for times within [2^(i-1), 2^i) us
+        const auto usec = static_cast<uint64_t>(time.count()) / 1000;
+        const auto bucket = std::min<std::size_t>(std::bit_width(usec), Metrics::DISPATCH_TIME_HISTOGRAM_SIZE - 1);
+        metrics_.dispatchTimeHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return r;
+}
+
+std::chrono::steady_clock::time_point Connection::startTimingMeasurement() const
+{
+    if (!metrics_.timingEnabled.load(std::memory_order_relaxed))
+        return {};
+
+    return std::chrono::steady_clock::now();
+}
+
+void Connection::addPollTime(std::chrono::steady_clock::time_point start)
+{
+    if (start == std::chrono::steady_clock::time_point{})
+        return;
+
+    const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    metrics_.pollTimeNs.fetch_add(static_cast<uint64_t>(time.count()), std::memory_order_relaxed);
+}
+
+Slot Connection::makeCountedSlot(sd_bus_slot* slot, std::atomic<uint64_t>& counter)
+{
+    counter.fetch_add(1, std::memory_order_relaxed);
+
+    return {slot, [this, &counter](void *slot)
+    {
+        sdbus_->sd_bus_slot_unref(static_cast<sd_bus_slot*>(slot));
+        counter.fetch_sub(1, std::memory_order_relaxed);
+    }};
+}
+
 Message Connection::getCurrentlyProcessedMessage() const
 {
     auto* sdbusMsg = sdbus_->sd_bus_get_current_message(bus_.get());
@@ -912,6 +1399,58 @@ int Connection::sdbus_match_callback(sd_bus_message *sdbusMessage, void *userDat
     return ok ? 0 : -1;
 }
 
+int Connection::sdbus_signal_demux_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError)
+{
+    auto* match = static_cast<SignalMatch*>(userData);
+    assert(match != nullptr);
+    auto& connection = match->connection;
+
+    const auto* objectPath = sd_bus_message_get_path(sdbusMessage);
+    const auto* interfaceName = sd_bus_message_get_interface(sdbusMessage);
+    const auto* signalName = sd_bus_message_get_member(sdbusMessage);
+    if (objectPath == nullptr || interfaceName == nullptr || signalName == nullptr)
+        return 0;
+
+    // We are called from within sd_bus_process(), so the bus lock is held, guarding the match and the key buffer
+    auto& key = connection.signalKey_;
+    makeSignalKey(key, objectPath, interfaceName, signalName);
+    auto range = match->subscriptions.equal_range(key);
+    if (range.first == range.second)
+        return 0;
+
+    // Handlers may register and unregister signal handlers, including themselves, so with more than one
+    // handler we iterate over a snapshot, and check that a subscription is still alive before invoking it
+    int r{};
+    match->dispatching = true;
+    if (std::next(range.first) == range.second)
+    {
+        auto* subscription = range.first->second;
+        r = subscription->callback(sdbusMessage, subscription->userData, retError);
+    }
+    else
+    {
+        std::vector<SignalSubscription*> snapshot;
+        for (auto it = range.first; it != range.second; ++it)
+            snapshot.push_back(it->second);
+
+        for (auto* subscription : snapshot)
+        {
+            auto current = match->subscriptions.equal_range(key);
+            if (std::none_of(current.first, current.second, [subscription](const auto& item){ return item.second == subscription; }))
+                continue;
+            r = subscription->callback(sdbusMessage, subscription->userData, retError);
+            if (r != 0)
+                break;
+        }
+    }
+    match->dispatching = false;
+
+    if (match->subscriptions.empty())
+        connection.removeSignalMatch(*match);
+
+    return r;
+}
+
 int Connection::sdbus_match_install_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError)
 {
     auto* matchInfo = static_cast<MatchInfo*>(userData);
@@ -33,11 +33,22 @@
 
 #include "IConnection.h"
 #include "ISdBus.h"
-
+#include "IoUringPoller.h"
+#include "WorkerPool.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include SDBUS_HEADER
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 // Forward declarations
@@ -97,6 +108,12 @@ namespace sdbus::internal {
 
         void requestName(const ServiceName & name) override;
         void releaseName(const ServiceName& name) override;
+        void enableMultithreadedDispatch(std::size_t workerCount, DispatchOrdering ordering) override;
+        [[nodiscard]] Slot startBatch() override;
+        void enableSignalDemultiplexing(const ObjectPath& pathNamespace) override;
+        void enableIoUringEventLoop() override;
+        [[nodiscard]] Metrics getMetrics() const override;
+        void enableTimingMetrics() override;
         [[nodiscard]] BusName getUniqueName() const override;
         void enterEventLoop() override;
         void enterEventLoopAsync() override;
@@ -180,6 +197,11 @@ namespace sdbus::internal {
         sd_bus_message* createMethodReply(sd_bus_message* sdbusMsg) override;
         sd_bus_message* createErrorReplyMessage(sd_bus_message* sdbusMsg, const Error& error) override;
 
+        [[nodiscard]] bool dispatchesMethodCallsToWorkers() const override;
+        void dispatchMethodCall(const MethodCall& call, std::function<void()> handler) override;
+
+        [[nodiscard]] Slot addTimer(std::chrono::microseconds delay, std::function<void()> callback) override;
+
     private:
         using BusFactory = std::function<int(sd_bus**)>;
         using BusPtr = std::unique_ptr<sd_bus, std::function<sd_bus*(sd_bus*)>>;
@@ -189,8 +211,32 @@ namespace sdbus::internal {
         BusPtr openPseudoBus();
         void finishHandshake(sd_bus* bus);
         bool waitForNextEvent();
+        void runIoUringEventLoop();
+        [[nodiscard]] bool isEventLoopRunningInAnotherThread() const;
+        [[nodiscard]] bool isBatchInProgressInThisThread() const;
+        void finishBatch() noexcept;
+        [[nodiscard]] bool isInSignalDemultiplexingNamespace(const char* objectPath) const;
+        Slot registerDemultiplexedSignalHandler( const char* sender
+                                               , const char* objectPath
+                                               , const char* interfaceName
+                                               , const char* signalName
+                                               , sd_bus_message_handler_t callback
+                                               , void* userData );
+        struct SignalMatch;
+        void removeSignalMatch(SignalMatch& match);
+        static void makeSignalKey(std::string& key, const char* objectPath, const char* interfaceName, const char* signalName);
+        struct PendingSyncCall;
+        [[nodiscard]] bool registerPendingSyncCall(PendingSyncCall& call);
+        void unregisterPendingSyncCall(PendingSyncCall& call);
+        void abortPendingSyncCalls();
+        sd_bus_message* callMethodThroughEventLoop(PendingSyncCall& call, sd_bus_message* sdbusMsg, uint64_t timeout);
 
         [[nodiscard]] bool arePendingMessagesInQueues() const;
+        bool processDueTimers();
+        int processBus(sd_bus* bus);
+        [[nodiscard]] std::chrono::steady_clock::time_point startTimingMeasurement() const;
+        void addPollTime(std::chrono::steady_clock::time_point start);
+        Slot makeCountedSlot(sd_bus_slot* slot, std::atomic<uint64_t>& counter);
 
         void notifyEventLoopToExit();
         void notifyEventLoopToWakeUpFromPoll();
@@ -201,6 +247,8 @@ namespace sdbus::internal {
         static std::vector</*const */char*> to_strv(const std::vector<StringBasedType>& strings);
 
         static int sdbus_match_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError);
+        static int sdbus_signal_demux_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError);
+        static int sdbus_sync_call_reply_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError);
         static int sdbus_match_install_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError);
 
     
@@ -239,6 +287,52 @@ namespace sdbus::internal {
             Slot slot;
         };
 
+        // A signal handler registered in the signal demultiplexing mode
+        struct SignalSubscription
+        {
+            sd_bus_message_handler_t callback;
+            void* userData;
+        };
+
+        // A match rule shared by all demultiplexed signal handlers of one signal sender
+        struct SignalMatch
+        {
+            Connection& connection; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+            std::string sender;
+            Slot slot;
+            std::unordered_multimap<std::string, SignalSubscription*> subscriptions; // Keyed by object path, interface and signal name
+            bool dispatching{}; // Whether a signal is being dispatched to the subscriptions at the moment
+        };
+
+        // A synchronous method call whose reply is awaited while the event loop keeps dispatching other messages
+        struct PendingSyncCall
+        {
+            Connection& connection; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+            std::mutex mutex;
+            std::condition_variable cond;
+            sd_bus_message* reply{};
+            bool aborted{}; // The event loop exited before delivering the reply
+        };
+
+        // A timer added through addTimer(), owned by the returned slot
+        struct Timer
+        {
+            std::chrono::microseconds deadline; // Absolute, on CLOCK_MONOTONIC
+            std::function<void()> callback;
+        };
+
+        // Counters behind getMetrics(), updated with relaxed atomic operations
+        struct MetricsCounters
+        {
+            std::atomic<uint64_t> processedMessages{};
+            std::atomic<uint64_t> pendingAsyncCalls{};
+            std::atomic<uint64_t> matchRules{};
+            std::atomic<bool> timingEnabled{};
+            std::atomic<uint64_t> dispatchTimeNs{};
+            std::atomic<uint64_t> pollTimeNs{};
+            std::array<std::atomic<uint64_t>, Metrics::DISPATCH_TIME_HISTOGRAM_SIZE> dispatchTimeHistogram{};
+        };
+
         // sd-event integration
         struct SdEvent
         {
@@ -250,11 +344,31 @@ namespace sdbus::internal {
 
         std::unique_ptr<ISdBus> sdbus_;
         BusPtr bus_;
+        // Deleters of counted slots decrement these counters, so they must outlive all members holding such slots
+        MetricsCounters metrics_;
+        // Workers may hold references to messages of the bus, so they must be destroyed before the bus
+        std::unique_ptr<WorkerPool> dispatchWorkers_;
+        DispatchOrdering dispatchOrdering_{DispatchOrdering::PerObject};
         std::thread asyncLoopThread_;
+        std::atomic<std::thread::id> eventLoopThreadId_; // Thread running enterEventLoop(), if any
+        std::mutex pendingSyncCallsMutex_;
+        std::vector<PendingSyncCall*> pendingSyncCalls_; // Sync calls awaiting their reply from the event loop, guarded by pendingSyncCallsMutex_
+        std::atomic<std::thread::id> batchThreadId_; // Thread running a batch of outgoing messages, if any
+        unsigned int batchDepth_{}; // Nesting level of the batch in progress, guarded by the bus lock
+        std::chrono::microseconds batchPollTimeout_{}; // Event loop poll timeout at the start of the batch, guarded by the bus lock
         EventFd loopExitFd_; // To wake up event loop I/O polling to exit
         EventFd eventFd_; // To wake up event loop I/O polling to re-enter poll with fresh PollData values
         std::vector<Slot> floatingMatchRules_;
+        std::string signalDemuxNamespace_; // Empty unless signal demultiplexing mode is enabled
+        std::map<std::string, std::unique_ptr<SignalMatch>> signalMatches_; // Keyed by signal sender, guarded by the bus lock
+        std::string signalKey_; // Reusable buffer for the look-up of demultiplexed signal handlers, guarded by the bus lock
         std::unique_ptr<SdEvent> sdEvent_; // Integration of systemd sd-event event loop implementation
+        std::unique_ptr<IoUringPoller> ioUringPoller_; // Used by the internal event loop instead of poll(), if enabled
+        mutable std::mutex timersMutex_;
+        std::vector<Timer*> timers_; // Armed timers, guarded by timersMutex_
+        std::atomic<std::size_t> armedTimerCount_{}; // To skip timer processing cheaply when there are no timers
+        std::recursive_mutex timerCallbackMutex_; // Held while timer callbacks run, always taken after the bus lock
+        std::vector<Timer*> firingTimers_; // Due timers whose callbacks are being run, guarded by timerCallbackMutex_
     };
 
 } // namespace sdbus::internal
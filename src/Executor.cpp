@@ -0,0 +1,68 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file Executor.cpp
+ *
+ * Created on: Oct 16, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sdbus-c++/Executor.h"
+
+#include "WorkerPool.h"
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace sdbus::internal {
+
+class ThreadPoolExecutor final : public IExecutor
+{
+public:
+    explicit ThreadPoolExecutor(std::size_t threadCount)
+        : workers_(threadCount)
+    {
+    }
+
+    void post(std::function<void()> job) override
+    {
+        // Jobs of an executor are independent of each other, so there is no affinity to keep
+        auto key = nextKey_.fetch_add(1, std::memory_order_relaxed);
+        workers_.post(key, std::move(job));
+    }
+
+private:
+    WorkerPool workers_;
+    std::atomic<std::size_t> nextKey_{};
+};
+
+} // namespace sdbus::internal
+
+namespace sdbus {
+
+std::unique_ptr<IExecutor> createThreadPoolExecutor(std::size_t threadCount)
+{
+    return std::make_unique<internal::ThreadPoolExecutor>(threadCount);
+}
+
+} // namespace sdbus
@@ -31,6 +31,8 @@
 
 #include "sdbus-c++/TypeTraits.h"
 
+#include <chrono>
+#include <functional>
 #include <memory>
 #include SDBUS_HEADER
 #include <vector>
@@ -124,6 +126,15 @@ namespace sdbus::internal {
 
         virtual sd_bus_message* createMethodReply(sd_bus_message* sdbusMsg) = 0;
         virtual sd_bus_message* createErrorReplyMessage(sd_bus_message* sdbusMsg, const Error& error) = 0;
+
+        // Multi-threaded dispatch support: method call handlers are handed over to a worker thread pool
+        [[nodiscard]] virtual bool dispatchesMethodCallsToWorkers() const = 0;
+        virtual void dispatchMethodCall(const MethodCall& call, std::function<void()> handler) = 0;
+
+        // One-shot timer driven by the event loop of the connection. The callback is invoked in the event loop
+        // thread once the delay elapses, unless the returned slot is destroyed before. Destroying the slot waits
+        // for the callback to finish if it is running in another thread at that moment.
+        [[nodiscard]] virtual Slot addTimer(std::chrono::microseconds delay, std::function<void()> callback) = 0;
     };
 
     [[nodiscard]] std::unique_ptr<IConnection> createPseudoConnection();
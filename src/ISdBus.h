@@ -108,6 +108,10 @@ namespace sdbus::internal {
         virtual int sd_bus_creds_get_egid(sd_bus_creds *creds, gid_t *egid) = 0;
         virtual int sd_bus_creds_get_supplementary_gids(sd_bus_creds *creds, const gid_t **gids) = 0;
         virtual int sd_bus_creds_get_selinux_context(sd_bus_creds *creds, const char **label) = 0;
+
+        // Explicit locking of the bus, for a sequence of the above calls to be performed as one critical section
+        virtual void lock() = 0;
+        virtual void unlock() = 0;
     };
 
 } // namespace sdbus::internal
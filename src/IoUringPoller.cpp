@@ -0,0 +1,295 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file IoUringPoller.cpp
+ *
+ * Created on: Oct 16, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "IoUringPoller.h"
+
+#include "sdbus-c++/Error.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#ifdef SDBUSCPP_HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace sdbus::internal {
+
+#ifdef SDBUSCPP_HAVE_IO_URING
+
+namespace {
+// The ring holds at most two event fd reads, a bus poll and a removal of the previous bus poll at a time
+constexpr unsigned int RING_ENTRIES{8};
+constexpr uint64_t REQUEST_MASK{0xff};
+constexpr unsigned int GENERATION_SHIFT{8};
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+template <typename T>
+T* ringField(void* ring, uint32_t offset)
+{
+    return reinterpret_cast<T*>(static_cast<char*>(ring) + offset);
+}
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+void* mapRing(int ringFd, std::size_t size, off_t offset)
+{
+    auto* ring = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, offset);
+    SDBUS_THROW_ERROR_IF(ring == MAP_FAILED, "Failed to map io_uring ring", errno);
+    return ring;
+}
+} // namespace
+
+IoUringPoller::IoUringPoller(int eventFd, int loopExitFd)
+    : eventFd_(eventFd)
+    , loopExitFd_(loopExitFd)
+{
+    io_uring_params params{};
+    ringFd_ = static_cast<int>(syscall(__NR_io_uring_setup, RING_ENTRIES, &params));
+    SDBUS_THROW_ERROR_IF(ringFd_ < 0, "Failed to set up io_uring", errno);
+
+    try
+    {
+        // Waiting with a timeout needs IORING_FEAT_EXT_ARG (Linux 5.11)
+        SDBUS_THROW_ERROR_IF(!(params.features & IORING_FEAT_EXT_ARG), "io_uring of the kernel is too old", ENOTSUP); // NOLINT(readability-implicit-bool-conversion)
+
+        sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+        cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP) // NOLINT(readability-implicit-bool-conversion)
+            sqRingSize_ = cqRingSize_ = std::max(sqRingSize_, cqRingSize_);
+
+        sqRing_ = mapRing(ringFd_, sqRingSize_, IORING_OFF_SQ_RING);
+        if (params.features & IORING_FEAT_SINGLE_MMAP) // NOLINT(readability-implicit-bool-conversion)
+            cqRing_ = sqRing_;
+        else
+            cqRing_ = mapRing(ringFd_, cqRingSize_, IORING_OFF_CQ_RING);
+        sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe*>(mapRing(ringFd_, sqesSize_, IORING_OFF_SQES));
+    }
+    catch (...)
+    {
+        releaseRing();
+        throw;
+    }
+
+    sqHead_ = ringField<unsigned int>(sqRing_, params.sq_off.head);
+    sqTail_ = ringField<unsigned int>(sqRing_, params.sq_off.tail);
+    sqMask_ = *ringField<unsigned int>(sqRing_, params.sq_off.ring_mask);
+    sqArray_ = ringField<unsigned int>(sqRing_, params.sq_off.array);
+    cqHead_ = ringField<unsigned int>(cqRing_, params.cq_off.head);
+    cqTail_ = ringField<unsigned int>(cqRing_, params.cq_off.tail);
+    cqMask_ = *ringField<unsigned int>(cqRing_, params.cq_off.ring_mask);
+    cqes_ = ringField<io_uring_cqe>(cqRing_, params.cq_off.cqes);
+    sqLocalTail_ = *sqTail_;
+
+    prepareRead(eventFd_, eventFdValue_, Request::EventFdRead);
+    prepareRead(loopExitFd_, loopExitFdValue_, Request::LoopExitFdRead);
+}
+
+IoUringPoller::~IoUringPoller()
+{
+    // A pending bus poll holds a reference to the bus socket, and the ring is torn down asynchronously
+    // by the kernel. Cancel the poll first, lest the socket outlives the connection closing it.
+    try
+    {
+        cancelBusPoll();
+    }
+    catch (...) // NOLINT(bugprone-empty-catch)
+    {
+        // The ring is torn down anyway, just a bit later
+    }
+
+    releaseRing();
+}
+
+void IoUringPoller::releaseRing() noexcept
+{
+    // Closing the ring cancels all requests still in flight
+    if (sqes_ != nullptr)
+        munmap(sqes_, sqesSize_);
+    if (cqRing_ != nullptr && cqRing_ != sqRing_)
+        munmap(cqRing_, cqRingSize_);
+    if (sqRing_ != nullptr)
+        munmap(sqRing_, sqRingSize_);
+    if (ringFd_ >= 0)
+        close(ringFd_);
+}
+
+bool IoUringPoller::wait(int busFd, short int busEvents, std::chrono::microseconds timeout)
+{
+    // The bus poll stays armed across waits, unless sd-bus wants to watch for different events now
+    if (!busPollArmed_ || busEvents != busPollEvents_)
+        prepareBusPoll(busFd, busEvents);
+
+    submitAndWait(timeout);
+
+    return processCompletions();
+}
+
+bool IoUringPoller::processCompletions()
+{
+    bool exitRequested{};
+    auto head = *cqHead_;
+    const auto tail = std::atomic_ref(*cqTail_).load(std::memory_order_acquire);
+    for (; head != tail; ++head)
+    {
+        const auto& cqe = cqes_[head & cqMask_]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        switch (requestOf(cqe.user_data))
+        {
+            case Request::EventFdRead:
+                // Just a wake-up, so that we re-enter the wait with fresh poll data
+                prepareRead(eventFd_, eventFdValue_, Request::EventFdRead);
+                break;
+            case Request::LoopExitFdRead:
+                exitRequested = true;
+                prepareRead(loopExitFd_, loopExitFdValue_, Request::LoopExitFdRead);
+                break;
+            case Request::BusPoll:
+                // A completion of the current bus poll (readiness or error), not of one removed before
+                if (cqe.user_data >> GENERATION_SHIFT == busPollGeneration_)
+                    busPollArmed_ = false;
+                break;
+            case Request::BusPollRemove:
+                break;
+        }
+    }
+    std::atomic_ref(*cqHead_).store(head, std::memory_order_release);
+
+    return !exitRequested;
+}
+
+void IoUringPoller::cancelBusPoll()
+{
+    if (!busPollArmed_)
+        return;
+
+    prepareBusPollRemove();
+
+    // Poll removal is handled synchronously on submission, so one wait is enough in practice
+    constexpr auto maxWait = std::chrono::milliseconds(100);
+    submitAndWait(maxWait);
+    (void)processCompletions();
+}
+
+io_uring_sqe& IoUringPoller::nextSqe()
+{
+    assert(sqLocalTail_ - std::atomic_ref(*sqHead_).load(std::memory_order_acquire) < RING_ENTRIES);
+
+    // The entry gets published to the kernel in submitAndWait()
+    auto index = sqLocalTail_++ & sqMask_;
+    auto& sqe = sqes_[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::memset(&sqe, 0, sizeof(sqe));
+    sqArray_[index] = index; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    return sqe;
+}
+
+void IoUringPoller::prepareRead(int fd, uint64_t& buffer, Request request)
+{
+    auto& sqe = nextSqe();
+    sqe.opcode = IORING_OP_READ;
+    sqe.fd = fd;
+    sqe.addr = reinterpret_cast<uint64_t>(&buffer); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    sqe.len = sizeof(buffer);
+    sqe.off = static_cast<uint64_t>(-1); // Event fds are not seekable
+    sqe.user_data = static_cast<uint64_t>(request);
+}
+
+void IoUringPoller::prepareBusPoll(int busFd, short int busEvents)
+{
+    if (busPollArmed_)
+        prepareBusPollRemove();
+
+    ++busPollGeneration_;
+    auto& sqe = nextSqe();
+    sqe.opcode = IORING_OP_POLL_ADD;
+    sqe.fd = busFd;
+    sqe.poll32_events = static_cast<uint16_t>(busEvents);
+    sqe.user_data = static_cast<uint64_t>(Request::BusPoll) | (busPollGeneration_ << GENERATION_SHIFT);
+
+    busPollArmed_ = true;
+    busPollEvents_ = busEvents;
+}
+
+void IoUringPoller::prepareBusPollRemove()
+{
+    auto& sqe = nextSqe();
+    sqe.opcode = IORING_OP_POLL_REMOVE;
+    sqe.addr = static_cast<uint64_t>(Request::BusPoll) | (busPollGeneration_ << GENERATION_SHIFT);
+    sqe.user_data = static_cast<uint64_t>(Request::BusPollRemove);
+}
+
+void IoUringPoller::submitAndWait(std::chrono::microseconds timeout)
+{
+    __kernel_timespec timespec{};
+    io_uring_getevents_arg arg{};
+    arg.sigmask_sz = _NSIG / 8;
+    if (timeout != std::chrono::microseconds::max())
+    {
+        auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+        timespec.tv_sec = seconds.count();
+        timespec.tv_nsec = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout - seconds).count();
+        arg.ts = reinterpret_cast<uint64_t>(&timespec); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    std::atomic_ref(*sqTail_).store(sqLocalTail_, std::memory_order_release);
+    const auto toSubmit = sqLocalTail_ - std::atomic_ref(*sqHead_).load(std::memory_order_acquire);
+    auto r = syscall(__NR_io_uring_enter, ringFd_, toSubmit, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+
+    // Timeouts and signal interruptions are regular wake-ups
+    SDBUS_THROW_ERROR_IF(r < 0 && errno != ETIME && errno != EINTR, "Failed to wait on the bus", errno);
+}
+
+IoUringPoller::Request IoUringPoller::requestOf(uint64_t userData)
+{
+    return static_cast<Request>(userData & REQUEST_MASK);
+}
+
+#else // SDBUSCPP_HAVE_IO_URING
+
+IoUringPoller::IoUringPoller(int eventFd, int loopExitFd)
+    : eventFd_(eventFd)
+    , loopExitFd_(loopExitFd)
+{
+    SDBUS_THROW_ERROR("sdbus-c++ was built without io_uring support", ENOTSUP);
+}
+
+IoUringPoller::~IoUringPoller() = default;
+
+bool IoUringPoller::wait(int /*busFd*/, short int /*busEvents*/, std::chrono::microseconds /*timeout*/)
+{
+    return false;
+}
+
+#endif // SDBUSCPP_HAVE_IO_URING
+
+} // namespace sdbus::internal
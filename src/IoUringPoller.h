@@ -0,0 +1,105 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file IoUringPoller.h
+ *
+ * Created on: Oct 16, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_INTERNAL_IOURINGPOLLER_H_
+#define SDBUS_CXX_INTERNAL_IOURINGPOLLER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Forward declarations
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace sdbus::internal {
+
+    // Waits for bus connection I/O readiness and event loop notifications through io_uring.
+    //
+    // Readiness of the bus fd and reads of the notification event fds are long-standing requests
+    // in the ring. Re-arming completed requests and waiting for new completions is done in a single
+    // io_uring_enter() call, and the kernel consumes event fd notifications itself, so the loop does
+    // not need separate read(2) calls to clear them. The poller is used by the event loop thread only.
+    //
+    // If sdbus-c++ is built without io_uring support, construction of the poller fails with ENOTSUP.
+    class IoUringPoller
+    {
+    public:
+        IoUringPoller(int eventFd, int loopExitFd);
+        IoUringPoller(const IoUringPoller&) = delete;
+        IoUringPoller& operator=(const IoUringPoller&) = delete;
+        IoUringPoller(IoUringPoller&&) = delete;
+        IoUringPoller& operator=(IoUringPoller&&) = delete;
+        ~IoUringPoller();
+
+        // Waits until busFd gets ready for busEvents, the event fd gets notified, or the timeout elapses.
+        // A timeout of microseconds::max() means no timeout. Returns false upon loop exit notification.
+        bool wait(int busFd, short int busEvents, std::chrono::microseconds timeout);
+
+    private:
+        enum class Request : uint64_t { EventFdRead, LoopExitFdRead, BusPoll, BusPollRemove };
+
+        bool processCompletions();
+        void cancelBusPoll();
+        void releaseRing() noexcept;
+        io_uring_sqe& nextSqe();
+        void prepareRead(int fd, uint64_t& buffer, Request request);
+        void prepareBusPoll(int busFd, short int busEvents);
+        void prepareBusPollRemove();
+        void submitAndWait(std::chrono::microseconds timeout);
+        static Request requestOf(uint64_t userData);
+
+        int ringFd_{-1};
+        void* sqRing_{};
+        std::size_t sqRingSize_{};
+        void* cqRing_{};
+        std::size_t cqRingSize_{};
+        io_uring_sqe* sqes_{};
+        std::size_t sqesSize_{};
+
+        // Ring indices and arrays shared with the kernel
+        unsigned int* sqHead_{};
+        unsigned int* sqTail_{};
+        unsigned int sqLocalTail_{}; // Tail including entries prepared, but not yet submitted
+        unsigned int sqMask_{};
+        unsigned int* sqArray_{};
+        unsigned int* cqHead_{};
+        unsigned int* cqTail_{};
+        unsigned int cqMask_{};
+        io_uring_cqe* cqes_{};
+
+        int eventFd_;
+        int loopExitFd_;
+        uint64_t eventFdValue_{}; // Read buffers for the event fds, written to by the kernel
+        uint64_t loopExitFdValue_{};
+        bool busPollArmed_{};
+        short int busPollEvents_{};
+        uint64_t busPollGeneration_{}; // Tells completions of a re-armed bus poll from those of a removed one
+    };
+
+} // namespace sdbus::internal
+
+#endif /* SDBUS_CXX_INTERNAL_IOURINGPOLLER_H_ */
@@ -0,0 +1,111 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file MemfdArray.cpp
+ *
+ * Created on: Oct 16, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sdbus-c++/MemfdArray.h"
+
+#include "sdbus-c++/Error.h"
+#include "sdbus-c++/Types.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <fcntl.h>
+#include <functional>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace sdbus::internal {
+
+namespace {
+// Seals that make the payload immutable for the receiver, no matter what the sender does afterwards
+constexpr int PAYLOAD_SEALS{F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE};
+} // namespace
+
+SealedMemfd::SealedMemfd(std::size_t size, const std::function<void(void*)>& filler)
+    : fd_(memfd_create("sdbus-c++-array", MFD_CLOEXEC | MFD_ALLOW_SEALING), adopt_fd)
+    , size_(size)
+{
+    SDBUS_THROW_ERROR_IF(!fd_.isValid(), "Failed to create memfd", errno);
+
+    auto r = ftruncate(fd_.get(), static_cast<off_t>(size_));
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to resize memfd", errno);
+
+    if (size_ > 0)
+    {
+        auto* data = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_.get(), 0);
+        SDBUS_THROW_ERROR_IF(data == MAP_FAILED, "Failed to map memfd", errno);
+        try
+        {
+            filler(data);
+        }
+        catch (...)
+        {
+            munmap(data, size_);
+            throw;
+        }
+        // Write seal can only be applied once there are no writable mappings
+        munmap(data, size_);
+    }
+
+    r = fcntl(fd_.get(), F_ADD_SEALS, PAYLOAD_SEALS | F_SEAL_SEAL);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to seal memfd", errno);
+
+    map();
+}
+
+SealedMemfd::SealedMemfd(UnixFd fd)
+    : fd_(std::move(fd))
+{
+    auto seals = fcntl(fd_.get(), F_GET_SEALS);
+    SDBUS_THROW_ERROR_IF(seals < 0, "Failed to get seals of received memfd", errno);
+    SDBUS_THROW_ERROR_IF((seals & PAYLOAD_SEALS) != PAYLOAD_SEALS, "Received memfd is not sealed against modification", EPERM);
+
+    struct stat status{};
+    auto r = fstat(fd_.get(), &status);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to get size of received memfd", errno);
+    size_ = static_cast<std::size_t>(status.st_size);
+
+    map();
+}
+
+SealedMemfd::~SealedMemfd()
+{
+    if (data_ != nullptr)
+        munmap(data_, size_);
+}
+
+void SealedMemfd::map()
+{
+    if (size_ == 0)
+        return; // Zero-length mappings are not allowed
+
+    auto* data = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd_.get(), 0);
+    SDBUS_THROW_ERROR_IF(data == MAP_FAILED, "Failed to map memfd", errno);
+    data_ = data;
+}
+
+} // namespace sdbus::internal
@@ -0,0 +1,147 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file MemoryPool.h
+ *
+ * Created on: Oct 15, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_INTERNAL_MEMORYPOOL_H_
+#define SDBUS_CXX_INTERNAL_MEMORYPOOL_H_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace sdbus::internal {
+
+    // Thread-safe pool of equally sized memory blocks. The block size is adopted from the first allocation.
+    // Released blocks are kept in an intrusive free list for reuse instead of being returned to the heap,
+    // so a steady flow of allocations and deallocations of the same object type does not hit the allocator.
+    // Requests for blocks of other sizes are forwarded to the global operator new/delete.
+    class MemoryPool
+    {
+    public:
+        MemoryPool() = default;
+        MemoryPool(const MemoryPool&) = delete;
+        MemoryPool& operator=(const MemoryPool&) = delete;
+        MemoryPool(MemoryPool&&) = delete;
+        MemoryPool& operator=(MemoryPool&&) = delete;
+
+        ~MemoryPool()
+        {
+            while (freeBlocks_ != nullptr)
+            {
+                auto* block = freeBlocks_;
+                freeBlocks_ = block->next;
+                ::operator delete(block);
+            }
+        }
+
+        void* allocate(std::size_t size)
+        {
+            {
+                const std::lock_guard lock(mutex_);
+                if (blockSize_ == 0 && size >= sizeof(FreeBlock))
+                    blockSize_ = size;
+                if (size == blockSize_ && freeBlocks_ != nullptr)
+                {
+                    auto* block = freeBlocks_;
+                    freeBlocks_ = block->next;
+                    return block;
+                }
+            }
+
+            return ::operator new(size);
+        }
+
+        void deallocate(void* ptr, std::size_t size) noexcept
+        {
+            {
+                const std::lock_guard lock(mutex_);
+                if (size == blockSize_)
+                {
+                    freeBlocks_ = ::new (ptr) FreeBlock{freeBlocks_};
+                    return;
+                }
+            }
+
+            ::operator delete(ptr);
+        }
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        std::mutex mutex_;
+        std::size_t blockSize_{};
+        FreeBlock* freeBlocks_{};
+    };
+
+    // Standard allocator drawing memory from a shared MemoryPool, meant for std::allocate_shared and the like.
+    // The allocator co-owns the pool, so the pool outlives all objects (and shared_ptr control blocks) allocated from it.
+    template <typename T>
+    class PoolAllocator
+    {
+    public:
+        using value_type = T;
+
+        explicit PoolAllocator(std::shared_ptr<MemoryPool> pool) noexcept
+            : pool_(std::move(pool))
+        {
+        }
+
+        template <typename U>
+        PoolAllocator(const PoolAllocator<U>& other) noexcept // NOLINT(google-explicit-constructor)
+            : pool_(other.pool_)
+        {
+        }
+
+        T* allocate(std::size_t n)
+        {
+            static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "Over-aligned types are not supported");
+            return static_cast<T*>(pool_->allocate(n * sizeof(T)));
+        }
+
+        void deallocate(T* ptr, std::size_t n) noexcept
+        {
+            pool_->deallocate(ptr, n * sizeof(T));
+        }
+
+        template <typename U>
+        bool operator==(const PoolAllocator<U>& other) const noexcept
+        {
+            return pool_ == other.pool_;
+        }
+
+    private:
+        template <typename U> friend class PoolAllocator;
+
+        std::shared_ptr<MemoryPool> pool_;
+    };
+
+} // namespace sdbus::internal
+
+#endif /* SDBUS_CXX_INTERNAL_MEMORYPOOL_H_ */
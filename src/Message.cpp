@@ -34,8 +34,11 @@
 #include "MessageUtils.h"
 #include "ScopeGuard.h"
 
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <cerrno>
+#include <cstddef>
 #include <cstdint> // int16_t, uint64_t, ...
 #include <cstdio>
 #include <cstdlib> // atexit
@@ -90,8 +93,10 @@ Message& Message::operator=(const Message& other) noexcept
     msg_ = other.msg_;
     connection_ = other.connection_;
     ok_ = other.ok_;
+    creds_ = other.creds_;
 
-    connection_->incrementMessageRefCount(static_cast<sd_bus_message*>(msg_));
+    if (msg_)
+        connection_->incrementMessageRefCount(static_cast<sd_bus_message*>(msg_));
 
     return *this;
 }
@@ -112,6 +117,7 @@ Message& Message::operator=(Message&& other) noexcept
     other.connection_ = nullptr;
     ok_ = other.ok_;
     other.ok_ = true;
+    creds_ = std::move(other.creds_);
 
     return *this;
 }
@@ -402,6 +408,17 @@ Message& Message::operator>>(std::string& item)
     return *this;
 }
 
+Message& Message::operator>>(std::string_view& item)
+{
+    char* str{};
+    (*this) >> str;
+
+    if (str != nullptr)
+        item = str;
+
+    return *this;
+}
+
 Message& Message::operator>>(Variant &item)
 {
     item.deserializeFrom(*this);
@@ -709,90 +726,164 @@ bool Message::isAtEnd(bool complete) const
     return sd_bus_message_at_end(static_cast<sd_bus_message*>(msg_), complete) > 0; // NOLINT(readability-implicit-bool-conversion)
 }
 
-// TODO: Create a RAII ownership class for creds with copy&move semantics, doing ref()/unref() under the hood.
-//   Create a method Message::querySenderCreds() that will return an object of this class by value, through IConnection and SdBus mutex.
-//   The class will expose methods like getPid(), getUid(), etc. that will directly call sd_bus_creds_* functions, no need for mutex here.
-pid_t Message::getCredsPid() const
+const Credentials& Message::getCreds(uint64_t mask) const
 {
-    const uint64_t mask = SD_BUS_CREDS_PID | SD_BUS_CREDS_AUGMENT;
-    sd_bus_creds *creds = nullptr;
-    SCOPE_EXIT{ connection_->decrementCredsRefCount(creds); };
+    // Sender credentials don't change over the lifetime of the message, so we ask the bus only if
+    // some of the requested fields have not been queried yet, and then for all fields at once.
+    if ((creds_.mask_ & mask) == mask)
+        return creds_;
 
-    int r = connection_->querySenderCredentials(static_cast<sd_bus_message*>(msg_), mask, &creds);
+    const uint64_t credsMask = creds_.mask_ | mask;
+    sd_bus_creds *creds = nullptr;
+    auto r = connection_->querySenderCredentials(static_cast<sd_bus_message*>(msg_), credsMask | SD_BUS_CREDS_AUGMENT, &creds);
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to get bus creds", -r);
 
+    creds_ = Credentials{creds, credsMask, connection_}; // Adopts the reference
+
+    return creds_;
+}
+
+pid_t Message::getCredsPid() const
+{
+    return getCreds(Credentials::Pid).getPid();
+}
+
+uid_t Message::getCredsUid() const
+{
+    return getCreds(Credentials::Uid).getUid();
+}
+
+uid_t Message::getCredsEuid() const
+{
+    return getCreds(Credentials::Euid).getEuid();
+}
+
+gid_t Message::getCredsGid() const
+{
+    return getCreds(Credentials::Gid).getGid();
+}
+
+gid_t Message::getCredsEgid() const
+{
+    return getCreds(Credentials::Egid).getEgid();
+}
+
+std::vector<gid_t> Message::getCredsSupplementaryGids() const
+{
+    return getCreds(Credentials::SupplementaryGids).getSupplementaryGids();
+}
+
+std::string Message::getSELinuxContext() const
+{
+    return getCreds(Credentials::SELinuxContext).getSELinuxContext();
+}
+
+Credentials::Credentials(void* creds, uint64_t mask, internal::IConnection* connection) noexcept
+    : creds_(creds)
+    , mask_(mask)
+    , connection_(connection)
+{
+    assert(creds_ != nullptr);
+    assert(connection_ != nullptr);
+}
+
+Credentials::Credentials(const Credentials& other) noexcept
+{
+    *this = other;
+}
+
+Credentials& Credentials::operator=(const Credentials& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    if (creds_)
+        connection_->decrementCredsRefCount(static_cast<sd_bus_creds*>(creds_));
+
+    creds_ = other.creds_;
+    mask_ = other.mask_;
+    connection_ = other.connection_;
+
+    if (creds_)
+        connection_->incrementCredsRefCount(static_cast<sd_bus_creds*>(creds_));
+
+    return *this;
+}
+
+Credentials::Credentials(Credentials&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+Credentials& Credentials::operator=(Credentials&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    if (creds_)
+        connection_->decrementCredsRefCount(static_cast<sd_bus_creds*>(creds_));
+
+    creds_ = other.creds_;
+    other.creds_ = nullptr;
+    mask_ = other.mask_;
+    other.mask_ = 0;
+    connection_ = other.connection_;
+    other.connection_ = nullptr;
+
+    return *this;
+}
+
+Credentials::~Credentials()
+{
+    if (creds_)
+        connection_->decrementCredsRefCount(static_cast<sd_bus_creds*>(creds_));
+}
+
+// Getters below access the state of the creds object only, so they call sd-bus directly, bypassing the SdBus mutex
+pid_t Credentials::getPid() const
+{
     pid_t pid = 0;
-    r = sd_bus_creds_get_pid(creds, &pid);
+    auto r = sd_bus_creds_get_pid(static_cast<sd_bus_creds*>(creds_), &pid);
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to get bus cred pid", -r);
     return pid;
 }
 
-uid_t Message::getCredsUid() const
+uid_t Credentials::getUid() const
 {
-    const uint64_t mask = SD_BUS_CREDS_UID | SD_BUS_CREDS_AUGMENT;
-    sd_bus_creds *creds = nullptr;
-    SCOPE_EXIT{ connection_->decrementCredsRefCount(creds); };
-    int r = connection_->querySenderCredentials(static_cast<sd_bus_message*>(msg_), mask, &creds);
-    SDBUS_THROW_ERROR_IF(r < 0, "Failed to get bus creds", -r);
-
     auto uid = static_cast<uid_t>(-1);
-    r = sd_bus_creds_get_uid(creds, &uid);
+    auto r = sd_bus_creds_get_uid(static_cast<sd_bus_creds*>(creds_), &uid);
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to get bus cred uid", -r);
     return uid;
 }
 
-uid_t Message::getCredsEuid() const
+uid_t Credentials::getEuid() const
 {
-    const uint64_t mask = SD_BUS_CREDS_EUID | SD_BUS_CREDS_AUGMENT;
-    sd_bus_creds *creds = nullptr;
-    SCOPE_EXIT{ connection_->decrementCredsRefCount(creds); };
-    int r = connection_->querySenderCredentials(static_cast<sd_bus_message*>(msg_), mask, &creds);
-    SDBUS_THROW_ERROR_IF(r < 0, "Failed to get bus creds", -r);
-
     auto euid = static_cast<uid_t>(-1);
-    r = sd_bus_creds_get_euid(creds, &euid);
+    auto r = sd_bus_creds_get_euid(static_cast<sd_bus_creds*>(creds_), &euid);
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to get bus cred euid", -r);
     return euid;
 }
 
-gid_t Message::getCredsGid() const
+gid_t Credentials::getGid() const
 {
-    const uint64_t mask = SD_BUS_CREDS_GID | SD_BUS_CREDS_AUGMENT;
-    sd_bus_creds *creds = nullptr;
-    SCOPE_EXIT{ connection_->decrementCredsRefCount(creds); };
-    int r = connection_->querySenderCredentials(static_cast<sd_bus_message*>(msg_), mask, &creds);
-    SDBUS_THROW_ERROR_IF(r < 0, "Failed to get bus creds", -r);
-
     auto gid = static_cast<gid_t>(-1);
-    r = sd_bus_creds_get_gid(creds, &gid);
+    auto r = sd_bus_creds_get_gid(static_cast<sd_bus_creds*>(creds_), &gid);
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to get bus cred gid", -r);
     return gid;
 }
 
-gid_t Message::getCredsEgid() const
+gid_t Credentials::getEgid() const
 {
-    const uint64_t mask = SD_BUS_CREDS_EGID | SD_BUS_CREDS_AUGMENT;
-    sd_bus_creds *creds = nullptr;
-    SCOPE_EXIT{ connection_->decrementCredsRefCount(creds); };
-    int r = connection_->querySenderCredentials(static_cast<sd_bus_message*>(msg_), mask, &creds);
-    SDBUS_THROW_ERROR_IF(r < 0, "Failed to get bus creds", -r);
-
     auto egid = static_cast<gid_t>(-1);
-    r = sd_bus_creds_get_egid(creds, &egid);
+    auto r = sd_bus_creds_get_egid(static_cast<sd_bus_creds*>(creds_), &egid);
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to get bus cred egid", -r);
     return egid;
 }
 
-std::vector<gid_t> Message::getCredsSupplementaryGids() const
+std::vector<gid_t> Credentials::getSupplementaryGids() const
 {
-    const uint64_t mask = SD_BUS_CREDS_SUPPLEMENTARY_GIDS | SD_BUS_CREDS_AUGMENT;
-    sd_bus_creds *creds = nullptr;
-    SCOPE_EXIT{ connection_->decrementCredsRefCount(creds); };
-    int r = connection_->querySenderCredentials(static_cast<sd_bus_message*>(msg_), mask, &creds);
-    SDBUS_THROW_ERROR_IF(r < 0, "Failed to get bus creds", -r);
-
     const gid_t *cGids = nullptr;
-    r = sd_bus_creds_get_supplementary_gids(creds, &cGids);
+    auto r = sd_bus_creds_get_supplementary_gids(static_cast<sd_bus_creds*>(creds_), &cGids);
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to get bus cred supplementary gids", -r);
 
     std::vector<gid_t> gids{};
@@ -805,20 +896,22 @@ std::vector<gid_t> Message::getCredsSupplementaryGids() const
     return gids;
 }
 
-std::string Message::getSELinuxContext() const
+std::string Credentials::getSELinuxContext() const
 {
-    const uint64_t mask = SD_BUS_CREDS_AUGMENT | SD_BUS_CREDS_SELINUX_CONTEXT;
-    sd_bus_creds *creds = nullptr;
-    SCOPE_EXIT{ connection_->decrementCredsRefCount(creds); };
-    int r = connection_->querySenderCredentials(static_cast<sd_bus_message*>(msg_), mask, &creds);
-    SDBUS_THROW_ERROR_IF(r < 0, "Failed to get bus creds", -r);
-
     const char *cLabel = nullptr;
-    r = sd_bus_creds_get_selinux_context(creds, &cLabel);
+    auto r = sd_bus_creds_get_selinux_context(static_cast<sd_bus_creds*>(creds_), &cLabel);
     SDBUS_THROW_ERROR_IF(r < 0, "Failed to get bus cred selinux context", -r);
     return cLabel;
 }
 
+static_assert(static_cast<uint64_t>(Credentials::Pid) == SD_BUS_CREDS_PID);
+static_assert(static_cast<uint64_t>(Credentials::Uid) == SD_BUS_CREDS_UID);
+static_assert(static_cast<uint64_t>(Credentials::Euid) == SD_BUS_CREDS_EUID);
+static_assert(static_cast<uint64_t>(Credentials::Gid) == SD_BUS_CREDS_GID);
+static_assert(static_cast<uint64_t>(Credentials::Egid) == SD_BUS_CREDS_EGID);
+static_assert(static_cast<uint64_t>(Credentials::SupplementaryGids) == SD_BUS_CREDS_SUPPLEMENTARY_GIDS);
+static_assert(static_cast<uint64_t>(Credentials::SELinuxContext) == SD_BUS_CREDS_SELINUX_CONTEXT);
+
 
 MethodCall::MethodCall( void *msg
                       , internal::IConnection *connection
@@ -922,37 +1015,57 @@ namespace {
 // Please note that the solution is NOT thread-safe.
 // Another common solution is global sdbus-c++ startup/shutdown functions, but that would be an intrusive change.
 
+// Plain messages are created from a small pool of pseudo connections rather than from a single one. Each pseudo
+// connection has its own sd-bus mutex, and every ref/unref of a plain message (so every Variant construction, copy
+// and destruction) takes the mutex of its connection. With one shared pseudo connection, that mutex would become
+// a process-wide point of contention for all threads working with Variants. Threads are spread over the pool
+// round-robin on their first use of it.
+
+constexpr std::size_t PSEUDO_CONNECTION_POOL_SIZE{8};
+
+struct PseudoConnectionPool
+{
+    std::array<std::unique_ptr<internal::IConnection>, PSEUDO_CONNECTION_POOL_SIZE> connections;
+};
+
 #ifdef __cpp_constinit
 constinit bool pseudoConnectionDestroyed{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 #else
 bool pseudoConnectionDestroyed{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 #endif
 
-std::unique_ptr<internal::IConnection, void(*)(internal::IConnection*)> createPseudoConnection()
+std::unique_ptr<PseudoConnectionPool, void(*)(PseudoConnectionPool*)> createPseudoConnectionPool()
 {
-    auto deleter = [](internal::IConnection* con)
+    auto deleter = [](PseudoConnectionPool* pool)
     {
-        delete con; // NOLINT(cppcoreguidelines-owning-memory)
+        delete pool; // NOLINT(cppcoreguidelines-owning-memory)
         pseudoConnectionDestroyed = true;
     };
 
-    return {internal::createPseudoConnection().release(), std::move(deleter)};
+    auto pool = std::make_unique<PseudoConnectionPool>();
+    for (auto& connection : pool->connections)
+        connection = internal::createPseudoConnection();
+
+    return {pool.release(), std::move(deleter)};
 }
 
 internal::IConnection& getPseudoConnectionInstance()
 {
-    static auto connection = createPseudoConnection();
+    static auto pool = createPseudoConnectionPool();
 
     if (pseudoConnectionDestroyed)
     {
-        connection = createPseudoConnection(); // Phoenix rising from the ashes
-        std::ignore = atexit([](){ connection.~unique_ptr(); }); // We have to manually take care of deleting the phoenix
+        pool = createPseudoConnectionPool(); // Phoenix rising from the ashes
+        std::ignore = atexit([](){ pool.~unique_ptr(); }); // We have to manually take care of deleting the phoenix
         pseudoConnectionDestroyed = false;
     }
 
-    assert(connection != nullptr);
+    assert(pool != nullptr);
+
+    static std::atomic<std::size_t> nextConnectionIndex{};
+    thread_local const std::size_t connectionIndex = nextConnectionIndex++ % PSEUDO_CONNECTION_POOL_SIZE;
 
-    return *connection;
+    return *pool->connections[connectionIndex];
 }
 
 } // namespace
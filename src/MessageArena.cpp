@@ -0,0 +1,134 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file MessageArena.cpp
+ *
+ * Created on: Oct 16, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sdbus-c++/MessageArena.h"
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#ifdef __cpp_lib_memory_resource
+
+namespace sdbus {
+
+MessageArena::MessageArena(std::size_t initialSize)
+    : buffer_(new std::byte[initialSize]) // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays): no zero-initialization needed
+    , capacity_(initialSize)
+{
+    resource_.emplace(buffer_.get(), capacity_, &overflow_);
+}
+
+MessageArena::~MessageArena() = default;
+
+std::pmr::memory_resource* MessageArena::resource() noexcept
+{
+    return &*resource_;
+}
+
+std::pmr::polymorphic_allocator<std::byte> MessageArena::allocator() noexcept
+{
+    return {resource()};
+}
+
+void MessageArena::reset() noexcept
+{
+    // Returns heap chunks obtained beyond the buffer, if any
+    resource_.reset();
+
+    if (overflow_.allocatedBytes > 0)
+    {
+        // Should the bigger buffer be unavailable, the current one is simply reused
+        const auto newCapacity = capacity_ + overflow_.allocatedBytes;
+        if (auto* newBuffer = new (std::nothrow) std::byte[newCapacity]) // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays,cppcoreguidelines-owning-memory)
+        {
+            buffer_.reset(newBuffer);
+            capacity_ = newCapacity;
+        }
+        overflow_.allocatedBytes = 0;
+    }
+
+    resource_.emplace(buffer_.get(), capacity_, &overflow_);
+}
+
+std::size_t MessageArena::capacity() const noexcept
+{
+    return capacity_;
+}
+
+void* MessageArena::OverflowResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    auto* ptr = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    allocatedBytes += bytes;
+    return ptr;
+}
+
+void MessageArena::OverflowResource::do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment)
+{
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+}
+
+bool MessageArena::OverflowResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+namespace internal {
+
+namespace {
+    struct HandlerArena
+    {
+        MessageArena arena;
+        unsigned depth{};
+    };
+
+    HandlerArena& handlerArena()
+    {
+        thread_local HandlerArena arena;
+        return arena;
+    }
+} // namespace
+
+std::pmr::memory_resource* enterHandlerArena()
+{
+    auto& handler = handlerArena();
+    ++handler.depth;
+    return handler.arena.resource();
+}
+
+void leaveHandlerArena() noexcept
+{
+    auto& handler = handlerArena();
+    assert(handler.depth > 0);
+    if (--handler.depth == 0)
+        handler.arena.reset();
+}
+
+} // namespace internal
+
+} // namespace sdbus
+
+#endif // __cpp_lib_memory_resource
@@ -42,7 +42,9 @@
 #include <algorithm>
 #include <cassert>
 #include <cerrno>
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include SDBUS_HEADER
 #include <string_view>
 #include <utility>
@@ -57,6 +59,11 @@ Object::Object(IConnection& connection, ObjectPath objectPath)
     SDBUS_CHECK_OBJECT_PATH(objectPath_.c_str());
 }
 
+Object::~Object()
+{
+    dropCoalescedPropertiesChanges();
+}
+
 void Object::addVTable(InterfaceName interfaceName, std::vector<VTableItem> vtable)
 {
     auto slot = Object::addVTable(std::move(interfaceName), std::move(vtable), return_slot);
@@ -70,6 +77,10 @@ Slot Object::addVTable(InterfaceName interfaceName, std::vector<VTableItem> vtab
 
     // 1st pass -- create vtable structure for internal sdbus-c++ purposes
     auto internalVTable = std::make_unique<VTable>(createInternalVTable(std::move(interfaceName), std::move(vtable)));
+    for (auto& methodItem : internalVTable->methods)
+        methodItem.vtable = internalVTable.get();
+    for (auto& propertyItem : internalVTable->properties)
+        propertyItem.vtable = internalVTable.get();
 
     // 2nd pass -- from internal sdbus-c++ vtable, create vtable structure in format expected by underlying sd-bus library
     internalVTable->sdbusVTable = createInternalSdBusVTable(*internalVTable);
@@ -82,11 +93,12 @@ Slot Object::addVTable(InterfaceName interfaceName, std::vector<VTableItem> vtab
                                                       , return_slot );
 
     // Return vtable wrapped in a Slot object
-    return {internalVTable.release(), [](void *ptr){ delete static_cast<VTable*>(ptr); }}; // NOLINT(cppcoreguidelines-owning-memory)
+    return {internalVTable.release(), [](void *ptr){ deleteVTable(static_cast<VTable*>(ptr)); }};
 }
 
 void Object::unregister()
 {
+    dropCoalescedPropertiesChanges();
     vtables_.clear();
     objectManagerSlot_.reset();
 }
@@ -110,11 +122,17 @@ void Object::emitSignal(const Signal& message)
 
 void Object::emitPropertiesChangedSignal(const InterfaceName& interfaceName, const std::vector<PropertyName>& propNames)
 {
+    if (coalescePropertiesChanges(interfaceName, propNames))
+        return;
+
     connection_.emitPropertiesChangedSignal(objectPath_, interfaceName, propNames);
 }
 
 void Object::emitPropertiesChangedSignal(const char* interfaceName, const std::vector<PropertyName>& propNames)
 {
+    if (coalescePropertiesChanges(interfaceName, propNames))
+        return;
+
     connection_.emitPropertiesChangedSignal(objectPath_.c_str(), interfaceName, propNames);
 }
 
@@ -128,6 +146,112 @@ void Object::emitPropertiesChangedSignal(const char* interfaceName)
     Object::emitPropertiesChangedSignal(interfaceName, {});
 }
 
+void Object::coalescePropertiesChangedSignals(const InterfaceName& interfaceName, std::chrono::microseconds interval)
+{
+    SDBUS_THROW_ERROR_IF(interval < std::chrono::microseconds::zero(), "Invalid PropertiesChanged coalescing interval", EINVAL);
+
+    std::unique_lock lock(coalescingMutex_);
+
+    if (interval > std::chrono::microseconds::zero())
+    {
+        // A new interval takes effect with the next accumulated change
+        coalescedChanges_[interfaceName].interval = interval;
+        return;
+    }
+
+    auto node = coalescedChanges_.extract(interfaceName);
+    lock.unlock();
+    if (!node.empty())
+        emitPropertiesChanges(node.key(), node.mapped());
+}
+
+void Object::flushPropertiesChangedSignals()
+{
+    std::vector<InterfaceName> interfaceNames;
+    {
+        std::lock_guard lock(coalescingMutex_);
+        for (const auto& [interfaceName, changes] : coalescedChanges_)
+            if (changes.timer)
+                interfaceNames.push_back(interfaceName);
+    }
+
+    for (const auto& interfaceName : interfaceNames)
+        flushPropertiesChanges(interfaceName);
+}
+
+bool Object::coalescePropertiesChanges(std::string_view interfaceName, const std::vector<PropertyName>& propNames)
+{
+    std::lock_guard lock(coalescingMutex_);
+
+    auto it = coalescedChanges_.find(interfaceName);
+    if (it == coalescedChanges_.end())
+        return false;
+
+    auto& changes = it->second;
+    if (propNames.empty())
+        changes.allProperties = true; // Supersedes individual properties
+    else if (!changes.allProperties)
+    {
+        for (const auto& propName : propNames)
+        {
+            auto pos = std::lower_bound(changes.propNames.begin(), changes.propNames.end(), propName);
+            if (pos == changes.propNames.end() || *pos != propName)
+                changes.propNames.insert(pos, propName);
+        }
+    }
+
+    if (!changes.timer)
+        changes.timer = connection_.addTimer(changes.interval, [this, interfaceName = it->first]()
+        {
+            try
+            {
+                flushPropertiesChanges(interfaceName);
+            }
+            catch (const Error&)
+            {
+                // There is no one to report the failure to in the event loop thread, the changes are dropped
+            }
+        });
+
+    return true;
+}
+
+void Object::flushPropertiesChanges(std::string_view interfaceName)
+{
+    CoalescedPropertiesChanges changes;
+    InterfaceName name;
+    {
+        std::lock_guard lock(coalescingMutex_);
+        auto it = coalescedChanges_.find(interfaceName);
+        if (it == coalescedChanges_.end())
+            return;
+        name = it->first;
+        changes.propNames = std::exchange(it->second.propNames, {});
+        changes.allProperties = std::exchange(it->second.allProperties, false);
+        // Released outside the lock, as the timer slot may wait for the timer callback, which takes the lock
+        changes.timer = std::move(it->second.timer);
+    }
+
+    emitPropertiesChanges(name, changes);
+}
+
+void Object::emitPropertiesChanges(const InterfaceName& interfaceName, CoalescedPropertiesChanges& changes)
+{
+    if (changes.allProperties)
+        connection_.emitPropertiesChangedSignal(objectPath_, interfaceName, {});
+    else if (!changes.propNames.empty())
+        connection_.emitPropertiesChangedSignal(objectPath_, interfaceName, changes.propNames);
+}
+
+void Object::dropCoalescedPropertiesChanges()
+{
+    std::unique_lock lock(coalescingMutex_);
+    auto coalescedChanges = std::move(coalescedChanges_);
+    coalescedChanges_.clear();
+    lock.unlock();
+    // Timer slots are released here, outside the lock
+}
+
 void Object::emitInterfacesAddedSignal()
 {
     connection_.emitInterfacesAddedSignal(objectPath_);
@@ -267,6 +391,7 @@ void Object::writeMethodRecordToSdBusVTable(const VTable::MethodItem& method, st
                                                  , method.outputSignature.c_str()
                                                  , method.paramNames.c_str()
                                                  , &Object::sdbus_method_callback
+                                                 , &method
                                                  , method.flags.toSdBusMethodFlags() );
     vtable.push_back(std::move(vtableItem));
 }
@@ -286,11 +411,13 @@ void Object::writePropertyRecordToSdBusVTable(const VTable::PropertyItem& proper
                     ? createSdBusVTableReadOnlyPropertyItem( property.name.c_str()
                                                            , property.signature.c_str()
                                                            , &Object::sdbus_property_get_callback
+                                                           , &property
                                                            , property.flags.toSdBusPropertyFlags() )
                     : createSdBusVTableWritablePropertyItem( property.name.c_str()
                                                            , property.signature.c_str()
                                                            , &Object::sdbus_property_get_callback
                                                            , &Object::sdbus_property_set_callback
+                                                           , &property
                                                            , property.flags.toSdBusWritablePropertyFlags() );
     vtable.push_back(std::move(vtableItem));
 }
@@ -320,6 +447,28 @@ const Object::VTable::PropertyItem* Object::findProperty(const VTable& vtable, s
     return it != vtable.properties.end() && it->name == propertyName ? &*it : nullptr;
 }
 
+// With sd-bus supporting absolute vtable offsets, the callbacks receive the vtable item they are registered for,
+// so no lookup is needed. Older sd-bus passes the whole vtable, in which the item is looked up by member name.
+const Object::VTable::MethodItem* Object::resolveMethodItem(void* userData, const char* methodName)
+{
+#if LIBSYSTEMD_VERSION>=246
+    (void)methodName;
+    return static_cast<const VTable::MethodItem*>(userData);
+#else
+    return findMethod(*static_cast<const VTable*>(userData), methodName);
+#endif
+}
+
+const Object::VTable::PropertyItem* Object::resolvePropertyItem(void* userData, const char* propertyName)
+{
+#if LIBSYSTEMD_VERSION>=246
+    (void)propertyName;
+    return static_cast<const VTable::PropertyItem*>(userData);
+#else
+    return findProperty(*static_cast<const VTable*>(userData), propertyName);
+#endif
+}
+
 std::string Object::paramNamesToString(const std::vector<std::string>& paramNames)
 {
     std::string names;
@@ -328,17 +477,86 @@ std::string Object::paramNamesToString(const std::vector<std::string>& paramName
     return names;
 }
 
+namespace {
+// The vtable whose dispatched method handler is being executed by the current worker thread
+thread_local const void* currentlyDispatchedVTable{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+} // namespace
+
+void Object::dispatchMethodCall(VTable& vtable, const VTable::MethodItem& methodItem, MethodCall call)
+{
+    auto dispatchedCalls = vtable.dispatchedCalls;
+    {
+        const std::lock_guard lock(dispatchedCalls->mutex);
+        ++dispatchedCalls->count;
+    }
+
+    auto& connection = vtable.object->connection_;
+    connection.dispatchMethodCall(call, [&vtable, &methodItem, dispatchedCalls = std::move(dispatchedCalls), call]()
+    {
+        currentlyDispatchedVTable = &vtable;
+
+        sd_bus_error sdbusError = SD_BUS_ERROR_NULL;
+        auto ok = invokeHandlerAndCatchErrors([&](){ methodItem.callback(call); }, &sdbusError);
+
+        // Here, `vtable' and `methodItem' may already be gone, if the handler destroyed them
+        currentlyDispatchedVTable = nullptr;
+
+        // The handler is not invoked from within sd-bus callback anymore,
+        // so we have to send the error reply to the caller on our own
+        if (!ok && !call.doesntExpectReply())
+        {
+            try
+            {
+                call.createErrorReply(Error{Error::Name{sdbusError.name}, sdbusError.message}).send();
+            }
+            catch (...) // NOLINT(bugprone-empty-catch)
+            {
+                // There is nobody to report the failure to (we are in a worker thread). The caller times out.
+            }
+        }
+        sd_bus_error_free(&sdbusError);
+
+        const std::lock_guard lock(dispatchedCalls->mutex);
+        --dispatchedCalls->count;
+        dispatchedCalls->cond.notify_all();
+    });
+}
+
+void Object::waitForDispatchedMethodCalls(const VTable& vtable)
+{
+    // If the vtable is being destroyed from within its own dispatched method handler, we must not wait for that one
+    const std::size_t callsInThisThread = currentlyDispatchedVTable == &vtable ? 1 : 0;
+
+    auto& dispatchedCalls = *vtable.dispatchedCalls;
+    std::unique_lock lock(dispatchedCalls.mutex);
+    dispatchedCalls.cond.wait(lock, [&](){ return dispatchedCalls.count <= callsInThisThread; });
+}
+
+void Object::deleteVTable(VTable* vtable)
+{
+    // Unregister the vtable from sd-bus first, so no new method calls can be dispatched for it
+    vtable->slot.reset();
+    waitForDispatchedMethodCalls(*vtable);
+
+    delete vtable; // NOLINT(cppcoreguidelines-owning-memory)
+}
+
 int Object::sdbus_method_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError)
 {
-    auto* vtable = static_cast<VTable*>(userData);
+    const auto* methodItem = resolveMethodItem(userData, sd_bus_message_get_member(sdbusMessage));
+    assert(methodItem != nullptr);
+    assert(methodItem->callback);
+    auto* vtable = methodItem->vtable;
     assert(vtable != nullptr);
     assert(vtable->object != nullptr);
 
     auto message = Message::Factory::create<MethodCall>(sdbusMessage, &vtable->object->connection_);
 
-    const auto* methodItem = findMethod(*vtable, message.getMemberName());
-    assert(methodItem != nullptr);
-    assert(methodItem->callback);
+    if (vtable->object->connection_.dispatchesMethodCallsToWorkers())
+    {
+        auto ok = invokeHandlerAndCatchErrors([&](){ dispatchMethodCall(*vtable, *methodItem, std::move(message)); }, retError);
+        return ok ? 1 : -1;
+    }
 
     auto ok = invokeHandlerAndCatchErrors([&](){ methodItem->callback(std::move(message)); }, retError);
 
@@ -353,13 +571,12 @@ int Object::sdbus_property_get_callback( sd_bus */*bus*/
                                        , void *userData
                                        , sd_bus_error *retError )
 {
-    auto* vtable = static_cast<VTable*>(userData);
+    const auto* propertyItem = resolvePropertyItem(userData, property);
+    assert(propertyItem != nullptr);
+    auto* vtable = propertyItem->vtable;
     assert(vtable != nullptr);
     assert(vtable->object != nullptr);
 
-    const auto* propertyItem = findProperty(*vtable, property);
-    assert(propertyItem != nullptr);
-
     // Getter may be empty - the case of "write-only" property
     if (!propertyItem->getCallback)
     {
@@ -382,12 +599,11 @@ int Object::sdbus_property_set_callback( sd_bus */*bus*/
                                        , void *userData
                                        , sd_bus_error *retError )
 {
-    auto* vtable = static_cast<VTable*>(userData);
+    const auto* propertyItem = resolvePropertyItem(userData, property);
+    assert(propertyItem != nullptr);
+    auto* vtable = propertyItem->vtable;
     assert(vtable != nullptr);
     assert(vtable->object != nullptr);
-
-    const auto* propertyItem = findProperty(*vtable, property);
-    assert(propertyItem != nullptr);
     assert(propertyItem->setCallback);
 
     auto value = Message::Factory::create<PropertySetCall>(sdbusValue, &vtable->object->connection_);
@@ -32,9 +32,14 @@
 #include "sdbus-c++/Types.h"
 
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <functional>
 #include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include SDBUS_HEADER
@@ -55,6 +60,11 @@ namespace sdbus::internal {
     {
     public:
         Object(IConnection& connection, ObjectPath objectPath);
+        Object(const Object&) = delete;
+        Object& operator=(const Object&) = delete;
+        Object(Object&&) = delete;
+        Object& operator=(Object&&) = delete;
+        ~Object() override;
 
         void addVTable(InterfaceName interfaceName, std::vector<VTableItem> vtable) override;
         Slot addVTable(InterfaceName interfaceName, std::vector<VTableItem> vtable, return_slot_t) override;
@@ -67,6 +77,8 @@ namespace sdbus::internal {
         void emitPropertiesChangedSignal(const char* interfaceName, const std::vector<PropertyName>& propNames) override;
         void emitPropertiesChangedSignal(const InterfaceName& interfaceName) override;
         void emitPropertiesChangedSignal(const char* interfaceName) override;
+        void coalescePropertiesChangedSignals(const InterfaceName& interfaceName, std::chrono::microseconds interval) override;
+        void flushPropertiesChangedSignals() override;
         void emitInterfacesAddedSignal() override;
         void emitInterfacesAddedSignal(const std::vector<InterfaceName>& interfaces) override;
         void emitInterfacesRemovedSignal() override;
@@ -96,6 +108,8 @@ namespace sdbus::internal {
                 std::string paramNames;
                 method_callback callback;
                 Flags flags;
+                // Back-reference to the owning vtable, for sd-bus callback handlers that receive the item itself
+                VTable* vtable{};
             };
             // Array of method records sorted by method name
             std::vector<MethodItem> methods;
@@ -117,6 +131,8 @@ namespace sdbus::internal {
                 property_get_callback getCallback;
                 property_set_callback setCallback;
                 Flags flags;
+                // Back-reference to the owning vtable, for sd-bus callback handlers that receive the item itself
+                VTable* vtable{};
             };
             // Array of signal records sorted by signal name
             std::vector<PropertyItem> properties;
@@ -127,11 +143,35 @@ namespace sdbus::internal {
             // Back-reference to the owning object from sd-bus callback handlers
             Object* object{};
 
+            // Method calls handed over to connection's dispatch workers and not yet finished.
+            // Shared with the dispatched jobs, as a method handler may well destroy its own vtable.
+            struct DispatchedCalls
+            {
+                std::mutex mutex;
+                std::condition_variable cond;
+                std::size_t count{};
+            };
+            std::shared_ptr<DispatchedCalls> dispatchedCalls{std::make_shared<DispatchedCalls>()};
+
             // This is intentionally the last member, because it must be destructed first,
             // releasing callbacks above before the callbacks themselves are destructed.
             Slot slot;
         };
 
+        // Changed properties of one interface, accumulated for a coalesced PropertiesChanged signal
+        struct CoalescedPropertiesChanges
+        {
+            std::chrono::microseconds interval{};
+            std::vector<PropertyName> propNames; // Sorted and unique
+            bool allProperties{}; // Set if all properties of the interface are to be emitted
+            Slot timer; // Armed while there are changes pending
+        };
+
+        bool coalescePropertiesChanges(std::string_view interfaceName, const std::vector<PropertyName>& propNames);
+        void flushPropertiesChanges(std::string_view interfaceName);
+        void emitPropertiesChanges(const InterfaceName& interfaceName, CoalescedPropertiesChanges& changes);
+        void dropCoalescedPropertiesChanges();
+
         VTable createInternalVTable(InterfaceName interfaceName, std::vector<VTableItem> vtable);
         static void writeInterfaceFlagsToVTable(InterfaceFlagsVTableItem flags, VTable& vtable);
         static void writeMethodRecordToVTable(MethodVTableItem method, VTable& vtable);
@@ -147,9 +187,15 @@ namespace sdbus::internal {
 
         static const VTable::MethodItem* findMethod(const VTable& vtable, std::string_view methodName);
         static const VTable::PropertyItem* findProperty(const VTable& vtable, std::string_view propertyName);
+        static const VTable::MethodItem* resolveMethodItem(void* userData, const char* methodName);
+        static const VTable::PropertyItem* resolvePropertyItem(void* userData, const char* propertyName);
 
         static std::string paramNamesToString(const std::vector<std::string>& paramNames);
 
+        static void dispatchMethodCall(VTable& vtable, const VTable::MethodItem& methodItem, MethodCall call);
+        static void waitForDispatchedMethodCalls(const VTable& vtable);
+        static void deleteVTable(VTable* vtable);
+
         static int sdbus_method_callback(sd_bus_message *sdbusMessage, void *userData, sd_bus_error *retError);
         static int sdbus_property_get_callback( sd_bus *bus
                                               , const char *objectPath
@@ -170,6 +216,8 @@ namespace sdbus::internal {
         ObjectPath objectPath_;
         std::vector<Slot> vtables_;
         Slot objectManagerSlot_;
+        std::mutex coalescingMutex_;
+        std::map<InterfaceName, CoalescedPropertiesChanges, std::less<>> coalescedChanges_; // Guarded by coalescingMutex_
     };
 
 } // namespace sdbus::internal
@@ -37,7 +37,6 @@
 #include "ScopeGuard.h"
 #include "Utils.h"
 
-#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <cerrno>
@@ -131,10 +130,11 @@ PendingAsyncCall Proxy::callMethodAsync(const MethodCall& message, async_reply_h
 {
     SDBUS_THROW_ERROR_IF(!message.isValid(), "Invalid async method call message provided", EINVAL);
 
-    auto asyncCallInfo = std::make_shared<AsyncCallInfo>(AsyncCallInfo{ .callback = std::move(asyncReplyCallback)
-                                                                      , .proxy = *this
-                                                                      , .slot = {}
-                                                                      , .floating = false });
+    auto asyncCallInfo = std::allocate_shared<AsyncCallInfo>( PoolAllocator<AsyncCallInfo>{asyncCallInfoPool_}
+                                                            , AsyncCallInfo{ .callback = std::move(asyncReplyCallback)
+                                                                           , .proxy = *this
+                                                                           , .slot = {}
+                                                                           , .floating = false } );
 
     asyncCallInfo->slot = message.send(reinterpret_cast<void*>(&Proxy::sdbus_async_reply_handler), asyncCallInfo.get(), timeout, return_slot);
 
@@ -329,26 +329,39 @@ Proxy::FloatingAsyncCallSlots::~FloatingAsyncCallSlots()
 void Proxy::FloatingAsyncCallSlots::push_back(std::shared_ptr<AsyncCallInfo> asyncCallInfo)
 {
     const std::lock_guard lock(mutex_);
-    if (!asyncCallInfo->finished) // The call may have finished in the meantime
-        slots_.emplace_back(std::move(asyncCallInfo));
+    if (asyncCallInfo->finished) // The call may have finished in the meantime
+        return;
+
+    if (!freeIndices_.empty())
+    {
+        asyncCallInfo->index = freeIndices_.back();
+        freeIndices_.pop_back();
+        slots_[asyncCallInfo->index] = std::move(asyncCallInfo);
+    }
+    else
+    {
+        asyncCallInfo->index = slots_.size();
+        slots_.push_back(std::move(asyncCallInfo));
+    }
 }
 
 void Proxy::FloatingAsyncCallSlots::erase(AsyncCallInfo* info)
 {
     std::unique_lock lock(mutex_);
     info->finished = true;
-    auto it = std::find_if(slots_.begin(), slots_.end(), [info](auto const& entry){ return entry.get() == info; });
-    if (it != slots_.end())
-    {
-        auto callInfo = std::move(*it);
-        slots_.erase(it);
-        lock.unlock();
-
-        // Releasing call slot pointer acquires global sd-bus mutex. We have to perform the release
-        // out of the `mutex_' critical section here, because if the `removeCall` is called by some
-        // thread and at the same time Proxy's async reply handler (which already holds global sd-bus
-        // mutex) is in progress in a different thread, we get double-mutex deadlock.
-    }
+    if (info->index == AsyncCallInfo::NO_INDEX)
+        return; // Not registered (yet), or removed already
+
+    assert(info->index < slots_.size() && slots_[info->index].get() == info);
+    auto callInfo = std::move(slots_[info->index]);
+    freeIndices_.push_back(info->index);
+    info->index = AsyncCallInfo::NO_INDEX;
+    lock.unlock();
+
+    // Releasing call slot pointer acquires global sd-bus mutex. We have to perform the release
+    // out of the `mutex_' critical section here, because if the `removeCall` is called by some
+    // thread and at the same time Proxy's async reply handler (which already holds global sd-bus
+    // mutex) is in progress in a different thread, we get double-mutex deadlock.
 }
 
 void Proxy::FloatingAsyncCallSlots::clear()
@@ -356,6 +369,10 @@ void Proxy::FloatingAsyncCallSlots::clear()
     std::unique_lock lock(mutex_);
     auto asyncCallSlots = std::move(slots_);
     slots_ = {};
+    freeIndices_ = {};
+    for (auto& asyncCallInfo : asyncCallSlots)
+        if (asyncCallInfo != nullptr)
+            asyncCallInfo->index = AsyncCallInfo::NO_INDEX;
     lock.unlock();
 
     // Releasing call slot pointer acquires global sd-bus mutex. We have to perform the release
@@ -30,9 +30,10 @@
 #include "sdbus-c++/IProxy.h"
 
 #include "IConnection.h"
+#include "MemoryPool.h"
 #include "sdbus-c++/Types.h"
 
-#include <deque>
+#include <cstddef>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -124,9 +125,13 @@ namespace sdbus::internal {
             Slot slot;
             bool finished{false};
             bool floating;
+            std::size_t index{NO_INDEX}; // Position in FloatingAsyncCallSlots, if registered there
+            static constexpr std::size_t NO_INDEX = static_cast<std::size_t>(-1);
         };
 
-        // Container keeping track of pending async calls
+        // Container keeping track of pending async calls. It's a slot map: each registered call
+        // remembers its index in the container, and freed indices are recycled, so both registering
+        // and removing a call take constant time regardless of the number of calls in flight.
         class FloatingAsyncCallSlots
         {
         public:
@@ -143,10 +148,13 @@ namespace sdbus::internal {
 
         private:
             std::mutex mutex_;
-            std::deque<std::shared_ptr<AsyncCallInfo>> slots_;
+            std::vector<std::shared_ptr<AsyncCallInfo>> slots_;
+            std::vector<std::size_t> freeIndices_;
         };
 
         FloatingAsyncCallSlots floatingAsyncCallSlots_;
+        // Recycles memory of AsyncCallInfo instances (together with their shared_ptr control blocks)
+        std::shared_ptr<MemoryPool> asyncCallInfoPool_{std::make_shared<MemoryPool>()};
     };
 
 } // namespace sdbus::internal
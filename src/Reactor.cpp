@@ -0,0 +1,335 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file Reactor.cpp
+ *
+ * Created on: Oct 16, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sdbus-c++/Reactor.h"
+
+#include "sdbus-c++/Error.h"
+#include "sdbus-c++/IConnection.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <thread>
+#include <unistd.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sdbus::internal {
+
+class Reactor final : public IReactor
+{
+public:
+    explicit Reactor(std::size_t threadCount);
+    Reactor(const Reactor&) = delete;
+    Reactor& operator=(const Reactor&) = delete;
+    Reactor(Reactor&&) = delete;
+    Reactor& operator=(Reactor&&) = delete;
+    ~Reactor() override;
+
+    void attach(IConnection& connection) override;
+    void detach(IConnection& connection) override;
+    void stop() override;
+
+private:
+    struct AttachedConnection
+    {
+        explicit AttachedConnection(IConnection& connection);
+        AttachedConnection(const AttachedConnection&) = delete;
+        AttachedConnection& operator=(const AttachedConnection&) = delete;
+        AttachedConnection(AttachedConnection&&) = delete;
+        AttachedConnection& operator=(AttachedConnection&&) = delete;
+        ~AttachedConnection();
+
+        IConnection& connection; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+        int timerFd{-1}; // Turns the poll timeout of the connection into an fd event
+        int busFd{-1};
+        int eventFd{-1};
+        std::recursive_mutex mutex; // Serializes processing among reactor threads. Recursive so that handlers may detach.
+        bool detached{};
+    };
+
+    void run();
+    void serve();
+    void process(uint64_t id);
+    void watch(AttachedConnection& attached, uint64_t id, int operation);
+    void unwatch(const AttachedConnection& attached);
+
+    // Identifies the exit notification among epoll events; connections have ids from 1 up
+    static constexpr uint64_t EXIT_ID{0};
+
+    int epollFd_{-1};
+    int exitFd_{-1};
+    std::mutex mutex_; // Guards the connection map
+    std::unordered_map<uint64_t, std::shared_ptr<AttachedConnection>> connections_;
+    uint64_t nextId_{EXIT_ID + 1};
+    std::vector<std::thread> threads_;
+    std::mutex errorMutex_;
+    std::exception_ptr error_; // First failure of a reactor thread, guarded by errorMutex_, reported from stop()
+};
+
+Reactor::Reactor(std::size_t threadCount)
+{
+    SDBUS_THROW_ERROR_IF(threadCount == 0, "Invalid number of reactor threads", EINVAL);
+
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    SDBUS_THROW_ERROR_IF(epollFd_ < 0, "Failed to create epoll instance", errno);
+
+    exitFd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (exitFd_ < 0)
+    {
+        auto error = errno;
+        close(epollFd_);
+        SDBUS_THROW_ERROR("Failed to create event object", error);
+    }
+
+    // Level-triggered and not one-shot, so that the exit notification wakes up all reactor threads
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = EXIT_ID;
+    (void)epoll_ctl(epollFd_, EPOLL_CTL_ADD, exitFd_, &event);
+
+    threads_.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+        threads_.emplace_back([this](){ run(); });
+}
+
+Reactor::~Reactor()
+{
+    try
+    {
+        Reactor::stop();
+    }
+    catch (...) // NOLINT(bugprone-empty-catch)
+    {
+        // A reactor thread failed, and the user did not call stop() to learn about it. There's no one to report it to now.
+    }
+
+    // Closing the epoll instance drops all watches of still attached connections
+    close(exitFd_);
+    close(epollFd_);
+}
+
+void Reactor::stop()
+{
+    (void)eventfd_write(exitFd_, 1);
+    for (auto& thread : threads_)
+        if (thread.joinable())
+            thread.join();
+
+    std::lock_guard lock(errorMutex_);
+    if (error_)
+        std::rethrow_exception(std::exchange(error_, nullptr));
+}
+
+void Reactor::attach(IConnection& connection)
+{
+    std::unique_lock lock(mutex_);
+
+    auto alreadyAttached = std::any_of(connections_.begin(), connections_.end(), [&](const auto& item){ return &item.second->connection == &connection; });
+    SDBUS_THROW_ERROR_IF(alreadyAttached, "Connection is already attached to the reactor", EALREADY);
+
+    auto id = nextId_++;
+    auto attached = std::make_shared<AttachedConnection>(connection);
+    connections_.emplace(id, attached);
+    lock.unlock();
+
+    std::lock_guard connectionLock(attached->mutex);
+    if (attached->detached)
+        return; // Detached by another thread in the meantime
+    try
+    {
+        watch(*attached, id, EPOLL_CTL_ADD);
+    }
+    catch (...)
+    {
+        unwatch(*attached);
+        lock.lock();
+        connections_.erase(id);
+        throw;
+    }
+}
+
+void Reactor::detach(IConnection& connection)
+{
+    std::unique_lock lock(mutex_);
+
+    auto it = std::find_if(connections_.begin(), connections_.end(), [&](const auto& item){ return &item.second->connection == &connection; });
+    SDBUS_THROW_ERROR_IF(it == connections_.end(), "Connection is not attached to the reactor", ENOENT);
+    auto attached = std::move(it->second);
+    connections_.erase(it);
+    lock.unlock();
+
+    // Waits for a reactor thread that may be processing the connection right now
+    std::lock_guard connectionLock(attached->mutex);
+    attached->detached = true;
+    unwatch(*attached);
+}
+
+void Reactor::run()
+{
+    try
+    {
+        serve();
+    }
+    catch (...)
+    {
+        // An exception escaping the thread would terminate the process. It's kept for stop() instead,
+        // and the other reactor threads are stopped, too, so that the failure doesn't go unnoticed.
+        std::lock_guard lock(errorMutex_);
+        if (!error_)
+            error_ = std::current_exception();
+        (void)eventfd_write(exitFd_, 1);
+    }
+}
+
+void Reactor::serve()
+{
+    constexpr std::size_t maxEventsPerWakeUp{16};
+    std::array<epoll_event, maxEventsPerWakeUp> events{};
+
+    while (true)
+    {
+        auto count = epoll_wait(epollFd_, events.data(), static_cast<int>(events.size()), -1);
+        if (count < 0 && errno == EINTR)
+            continue;
+        SDBUS_THROW_ERROR_IF(count < 0, "Failed to wait on the reactor", errno);
+
+        for (int i = 0; i < count; ++i)
+        {
+            auto id = events[static_cast<std::size_t>(i)].data.u64;
+            if (id == EXIT_ID)
+                return;
+            process(id);
+        }
+    }
+}
+
+void Reactor::process(uint64_t id)
+{
+    // How many messages at most to process in one go, so that a busy connection does not starve the others
+    constexpr unsigned int maxEventsPerWakeUp{64};
+
+    std::unique_lock lock(mutex_);
+    auto it = connections_.find(id);
+    if (it == connections_.end())
+        return; // Detached in the meantime
+    auto attached = it->second;
+    lock.unlock();
+
+    std::lock_guard connectionLock(attached->mutex);
+    try
+    {
+        for (unsigned int i = 0; i < maxEventsPerWakeUp && !attached->detached; ++i)
+            if (!attached->connection.processPendingEvent())
+                break;
+
+        // All fds of the connection are watched one-shot, so that no other reactor thread picks up
+        // the connection while we process it. Re-arm them with fresh poll data now.
+        if (!attached->detached)
+            watch(*attached, id, EPOLL_CTL_MOD);
+    }
+    catch (const Error&) // NOLINT(bugprone-empty-catch)
+    {
+        // The connection is broken, e.g. its peer has gone away. Its fds stay disarmed, and it's up
+        // to the user to detach it, which they are typically notified about through failing calls.
+    }
+}
+
+void Reactor::watch(AttachedConnection& attached, uint64_t id, int operation)
+{
+    auto pollData = attached.connection.getEventLoopPollData();
+
+    itimerspec timerSpec{};
+    if (pollData.timeout != std::chrono::microseconds::max())
+    {
+        auto seconds = std::chrono::duration_cast<std::chrono::seconds>(pollData.timeout);
+        timerSpec.it_value.tv_sec = seconds.count();
+        timerSpec.it_value.tv_nsec = std::chrono::duration_cast<std::chrono::nanoseconds>(pollData.timeout - seconds).count();
+        if (timerSpec.it_value.tv_sec == 0 && timerSpec.it_value.tv_nsec == 0)
+            timerSpec.it_value.tv_nsec = 1; // All-zero value would disarm the timer instead of expiring it right away
+    }
+    // Re-setting the timer also resets its expiration count, so the timer fd gets out of readable state
+    auto r = timerfd_settime(attached.timerFd, TFD_TIMER_ABSTIME, &timerSpec, nullptr);
+    SDBUS_THROW_ERROR_IF(r < 0, "Failed to set reactor timer", errno);
+
+    attached.busFd = pollData.fd;
+    attached.eventFd = pollData.eventFd;
+
+    // poll(2) and epoll(7) event flags share the same values
+    const std::array<std::pair<int, uint32_t>, 3> fds{{ {pollData.fd, static_cast<uint32_t>(pollData.events)}
+                                                       , {pollData.eventFd, EPOLLIN}
+                                                       , {attached.timerFd, EPOLLIN} }};
+    for (const auto& [fd, events] : fds)
+    {
+        epoll_event event{};
+        event.events = events | EPOLLONESHOT;
+        event.data.u64 = id;
+        r = epoll_ctl(epollFd_, operation, fd, &event);
+        SDBUS_THROW_ERROR_IF(r < 0, "Failed to watch connection in the reactor", errno);
+    }
+}
+
+void Reactor::unwatch(const AttachedConnection& attached)
+{
+    // Fds that are not registered (anymore) are simply skipped by the kernel
+    for (auto fd : {attached.busFd, attached.eventFd, attached.timerFd})
+        if (fd >= 0)
+            (void)epoll_ctl(epollFd_, EPOLL_CTL_DEL, fd, nullptr);
+}
+
+Reactor::AttachedConnection::AttachedConnection(IConnection& connection)
+    : connection(connection)
+    , timerFd(timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK))
+{
+    SDBUS_THROW_ERROR_IF(timerFd < 0, "Failed to create reactor timer", errno);
+}
+
+Reactor::AttachedConnection::~AttachedConnection()
+{
+    close(timerFd);
+}
+
+} // namespace sdbus::internal
+
+namespace sdbus {
+
+std::unique_ptr<IReactor> createReactor(std::size_t threadCount)
+{
+    return std::make_unique<internal::Reactor>(threadCount);
+}
+
+} // namespace sdbus
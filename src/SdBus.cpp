@@ -441,8 +441,6 @@ sd_bus* SdBus::sd_bus_close_unref(sd_bus *bus)
 
 int SdBus::sd_bus_message_set_destination(sd_bus_message *msg, const char *destination)
 {
-    const std::lock_guard lock(sdbusMutex_);
-
     return ::sd_bus_message_set_destination(msg, destination);
 }
 
@@ -469,51 +467,47 @@ sd_bus_creds* SdBus::sd_bus_creds_unref(sd_bus_creds *creds)
 
 int SdBus::sd_bus_creds_get_pid(sd_bus_creds *creds, pid_t *pid)
 {
-    const std::lock_guard lock(sdbusMutex_);
-
     return ::sd_bus_creds_get_pid(creds, pid);
 }
 
 int SdBus::sd_bus_creds_get_uid(sd_bus_creds *creds, uid_t *uid)
 {
-    const std::lock_guard lock(sdbusMutex_);
-
     return ::sd_bus_creds_get_uid(creds, uid);
 }
 
 int SdBus::sd_bus_creds_get_euid(sd_bus_creds *creds, uid_t *euid)
 {
-    const std::lock_guard lock(sdbusMutex_);
-
     return ::sd_bus_creds_get_euid(creds, euid);
 }
 
 int SdBus::sd_bus_creds_get_gid(sd_bus_creds *creds, gid_t *gid)
 {
-    const std::lock_guard lock(sdbusMutex_);
-
     return ::sd_bus_creds_get_gid(creds, gid);
 }
 
 int SdBus::sd_bus_creds_get_egid(sd_bus_creds *creds, uid_t *egid)
 {
-    const std::lock_guard lock(sdbusMutex_);
-
     return ::sd_bus_creds_get_egid(creds, egid);
 }
 
 int SdBus::sd_bus_creds_get_supplementary_gids(sd_bus_creds *creds, const gid_t **gids)
 {
-    const std::lock_guard lock(sdbusMutex_);
-
     return ::sd_bus_creds_get_supplementary_gids(creds, gids);
 }
 
 int SdBus::sd_bus_creds_get_selinux_context(sd_bus_creds *creds, const char **label)
 {
-    const std::lock_guard lock(sdbusMutex_);
-
     return ::sd_bus_creds_get_selinux_context(creds, label);
 }
 
+void SdBus::lock()
+{
+    sdbusMutex_.lock();
+}
+
+void SdBus::unlock()
+{
+    sdbusMutex_.unlock();
+}
+
 } // namespace sdbus::internal
@@ -101,7 +101,16 @@ public:
     int sd_bus_creds_get_supplementary_gids(sd_bus_creds *creds, const gid_t **gids) override;
     int sd_bus_creds_get_selinux_context(sd_bus_creds *creds, const char **label) override;
 
+    void lock() override;
+    void unlock() override;
+
 private:
+    // Per-bus mutex (there is one SdBus instance per connection). It guards everything that touches the sd_bus
+    // object, its queues, slots, or its reference count. Note that this includes sd_bus_message_ref/unref
+    // and message creation, since libsystemd couples each message reference with a non-atomic bus reference.
+    // Operations that only access the state of a single message or creds object (setting message destination,
+    // reading creds fields) do not take the mutex; the same holds for message (de)serialization and sealing,
+    // which sdbus-c++ performs directly on the message without going through this class.
     std::recursive_mutex sdbusMutex_;
 };
 
@@ -28,33 +28,82 @@
 #include "sdbus-c++/Message.h"
 #include "sdbus-c++/Types.h"
 
+#include <array>
+#include <cassert>
 #include <cerrno>
+#include <cstdint>
+#include <string>
 #include <system_error>
+#include <type_traits>
 #include SDBUS_HEADER
 #include <unistd.h>
+#include <utility>
+#include <variant>
 
 namespace sdbus {
 
-Variant::Variant()
-    : msg_(createPlainMessage())
+Variant::Variant() = default;
+
+Variant::Variant(Variant&& other) noexcept
+    : compactValue_(std::move(other.compactValue_))
+    , compactType_(std::exchange(other.compactType_, '\0'))
+    , msg_(std::move(other.msg_))
+{
+}
+
+Variant& Variant::operator=(Variant&& other) noexcept
 {
+    compactValue_ = std::move(other.compactValue_);
+    compactType_ = std::exchange(other.compactType_, '\0');
+    msg_ = std::move(other.msg_);
+
+    return *this;
 }
 
 void Variant::serializeTo(Message& msg) const
 {
     SDBUS_THROW_ERROR_IF(isEmpty(), "Empty variant is not allowed", EINVAL);
+    if (compactType_ != '\0')
+        return serializeCompactValueTo(msg);
+
     msg_.rewind(true);
     msg_.copyTo(msg, true);
 }
 
 void Variant::deserializeFrom(Message& msg)
 {
+    compactValue_ = {};
+    compactType_ = '\0';
+    msg_ = {};
+
+    auto [type, contents] = msg.peekType();
+    if (type == '\0')
+        return; // We are at the end of the enclosing container, the variant remains empty
+
+    if (type == SD_BUS_TYPE_VARIANT && contents != nullptr && detail::is_compact_variant_type(contents[0]) && contents[1] == '\0')
+    {
+        msg.enterVariant(contents);
+        deserializeCompactValueFrom(msg, contents[0]);
+        msg.exitVariant();
+        return;
+    }
+
+    msg_ = createPlainMessage();
     msg.copyTo(msg_, false);
     msg_.seal();
 }
 
 const char* Variant::peekValueType() const
 {
+    if (compactType_ != '\0')
+    {
+        static constexpr std::array<char, 2> signatures[] = { {'y'}, {'b'}, {'n'}, {'q'}, {'i'}, {'u'}, {'x'}, {'t'}, {'d'}, {'s'}, {'o'}, {'g'} };
+        for (const auto& signature : signatures)
+            if (signature[0] == compactType_)
+                return signature.data();
+    }
+
+    ensureMessage();
     msg_.rewind(false);
     auto [type, contents] = msg_.peekType();
     return contents;
@@ -62,7 +111,75 @@ const char* Variant::peekValueType() const
 
 bool Variant::isEmpty() const
 {
-    return msg_.isEmpty();
+    return compactType_ == '\0' && (!msg_.isValid() || msg_.isEmpty());
+}
+
+void Variant::ensureMessage() const
+{
+    if (msg_.isValid())
+        return;
+
+    msg_ = createPlainMessage();
+    if (compactType_ != '\0')
+    {
+        serializeCompactValueTo(msg_);
+        msg_.seal();
+    }
+}
+
+void Variant::serializeCompactValueTo(Message& msg) const
+{
+    const std::array<char, 2> signature{compactType_, '\0'};
+    msg.openVariant(signature.data());
+    std::visit([this, &msg](const auto& value)
+    {
+        using ValueType = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<ValueType, std::string>)
+        {
+            if (compactType_ == 'o')
+                msg << ObjectPath{value};
+            else if (compactType_ == 'g')
+                msg << Signature{value};
+            else
+                msg << value;
+        }
+        else if constexpr (!std::is_same_v<ValueType, std::monostate>)
+        {
+            msg << value;
+        }
+    }, compactValue_);
+    msg.closeVariant();
+}
+
+namespace {
+    template <typename ValueType>
+    ValueType read(Message& msg)
+    {
+        ValueType value{};
+        msg >> value;
+        return value;
+    }
+} // namespace
+
+void Variant::deserializeCompactValueFrom(Message& msg, char type)
+{
+    switch (type)
+    {
+        case 'y': compactValue_ = read<uint8_t>(msg); break;
+        case 'b': compactValue_ = read<bool>(msg); break;
+        case 'n': compactValue_ = read<int16_t>(msg); break;
+        case 'q': compactValue_ = read<uint16_t>(msg); break;
+        case 'i': compactValue_ = read<int32_t>(msg); break;
+        case 'u': compactValue_ = read<uint32_t>(msg); break;
+        case 'x': compactValue_ = read<int64_t>(msg); break;
+        case 't': compactValue_ = read<uint64_t>(msg); break;
+        case 'd': compactValue_ = read<double>(msg); break;
+        case 's': compactValue_ = read<std::string>(msg); break;
+        case 'o': compactValue_ = static_cast<std::string&&>(read<ObjectPath>(msg)); break;
+        case 'g': compactValue_ = static_cast<std::string&&>(read<Signature>(msg)); break;
+        default: assert(false);
+    }
+    compactType_ = type;
 }
 
 void UnixFd::close() // NOLINT(readability-make-member-function-const)
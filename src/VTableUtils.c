@@ -25,8 +25,19 @@
  */
 
 #include "VTableUtils.h"
+#include <stdint.h>
 #include SDBUS_HEADER
 
+// Since v246, sd-bus can pass the item's own user data pointer (stored in the offset field) to the item's callbacks
+// instead of the userdata of the whole vtable. Older versions ignore the item user data.
+#if LIBSYSTEMD_VERSION>=246
+#define ITEM_USERDATA_OFFSET(_USERDATA) ((size_t)(uintptr_t)(_USERDATA))
+#define ITEM_USERDATA_FLAGS SD_BUS_VTABLE_ABSOLUTE_OFFSET
+#else
+#define ITEM_USERDATA_OFFSET(_USERDATA) ((void)(_USERDATA), 0)
+#define ITEM_USERDATA_FLAGS 0
+#endif
+
 sd_bus_vtable createSdBusVTableStartItem(uint64_t flags)
 {
     struct sd_bus_vtable vtableStart = SD_BUS_VTABLE_START(flags);
@@ -38,6 +49,7 @@ sd_bus_vtable createSdBusVTableMethodItem( const char *member
                                          , const char *result
                                          , const char *paramNames
                                          , sd_bus_message_handler_t handler
+                                         , const void *userData
                                          , uint64_t flags )
 {
 #if LIBSYSTEMD_VERSION>=242
@@ -46,20 +58,21 @@ sd_bus_vtable createSdBusVTableMethodItem( const char *member
     struct sd_bus_vtable vtableItem =
     {
             .type = _SD_BUS_VTABLE_METHOD,
-            .flags = flags,
+            .flags = flags | ITEM_USERDATA_FLAGS,
             .x = {
                 .method = {
                     .member = member,
                     .signature = signature,
                     .result = result,
                     .handler = handler,
-                    .offset = 0,
+                    .offset = ITEM_USERDATA_OFFSET(userData),
                     .names = paramNames,
                 },
             },
     };
 #else
     (void)paramNames;
+    (void)userData;
     struct sd_bus_vtable vtableItem = SD_BUS_METHOD(member, signature, result, handler, flags);
 #endif
     return vtableItem;
@@ -82,9 +95,10 @@ sd_bus_vtable createSdBusVTableSignalItem( const char *member
 sd_bus_vtable createSdBusVTableReadOnlyPropertyItem( const char *member
                                                    , const char *signature
                                                    , sd_bus_property_get_t getter
+                                                   , const void *userData
                                                    , uint64_t flags )
 {
-    struct sd_bus_vtable vtableItem = SD_BUS_PROPERTY(member, signature, getter, 0, flags);
+    struct sd_bus_vtable vtableItem = SD_BUS_PROPERTY(member, signature, getter, ITEM_USERDATA_OFFSET(userData), flags | ITEM_USERDATA_FLAGS);
     return vtableItem;
 }
 
@@ -92,9 +106,10 @@ sd_bus_vtable createSdBusVTableWritablePropertyItem( const char *member
                                                    , const char *signature
                                                    , sd_bus_property_get_t getter
                                                    , sd_bus_property_set_t setter
+                                                   , const void *userData
                                                    , uint64_t flags )
 {
-    struct sd_bus_vtable vtableItem = SD_BUS_WRITABLE_PROPERTY(member, signature, getter, setter, 0, flags);
+    struct sd_bus_vtable vtableItem = SD_BUS_WRITABLE_PROPERTY(member, signature, getter, setter, ITEM_USERDATA_OFFSET(userData), flags | ITEM_USERDATA_FLAGS);
     return vtableItem;
 }
 
@@ -40,6 +40,7 @@ sd_bus_vtable createSdBusVTableMethodItem( const char *member
                                          , const char *result
                                          , const char *paramNames
                                          , sd_bus_message_handler_t handler
+                                         , const void *userData
                                          , uint64_t flags );
 sd_bus_vtable createSdBusVTableSignalItem( const char *member
                                          , const char *signature
@@ -48,11 +49,13 @@ sd_bus_vtable createSdBusVTableSignalItem( const char *member
 sd_bus_vtable createSdBusVTableReadOnlyPropertyItem( const char *member
                                                    , const char *signature
                                                    , sd_bus_property_get_t getter
+                                                   , const void *userData
                                                    , uint64_t flags );
 sd_bus_vtable createSdBusVTableWritablePropertyItem( const char *member
                                                    , const char *signature
                                                    , sd_bus_property_get_t getter
                                                    , sd_bus_property_set_t setter
+                                                   , const void *userData
                                                    , uint64_t flags );
 sd_bus_vtable createSdBusVTableEndItem();
 
@@ -0,0 +1,98 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file WorkerPool.cpp
+ *
+ * Created on: Oct 15, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorkerPool.h"
+
+#include "sdbus-c++/Error.h"
+
+#include <cassert>
+#include <cerrno>
+#include <utility>
+
+namespace sdbus::internal {
+
+WorkerPool::WorkerPool(std::size_t workerCount)
+{
+    SDBUS_THROW_ERROR_IF(workerCount == 0, "Invalid number of worker threads", EINVAL);
+
+    workers_.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i)
+    {
+        auto worker = std::make_unique<Worker>();
+        worker->thread = std::thread([&worker = *worker](){ run(worker); });
+        workers_.push_back(std::move(worker));
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    for (auto& worker : workers_)
+    {
+        std::unique_lock lock(worker->mutex);
+        worker->exit = true;
+        lock.unlock();
+        worker->cond.notify_one();
+    }
+
+    for (auto& worker : workers_)
+        if (worker->thread.joinable())
+            worker->thread.join();
+}
+
+void WorkerPool::post(std::size_t key, std::function<void()> job)
+{
+    assert(!workers_.empty());
+
+    auto& worker = *workers_[key % workers_.size()];
+
+    std::unique_lock lock(worker.mutex);
+    worker.jobs.push_back(std::move(job));
+    lock.unlock();
+    worker.cond.notify_one();
+}
+
+std::size_t WorkerPool::size() const
+{
+    return workers_.size();
+}
+
+void WorkerPool::run(Worker& worker)
+{
+    while (true)
+    {
+        std::unique_lock lock(worker.mutex);
+        worker.cond.wait(lock, [&worker]{ return !worker.jobs.empty() || worker.exit; });
+        if (worker.exit)
+            break; // Jobs still waiting in the queue are discarded
+        auto job = std::move(worker.jobs.front());
+        worker.jobs.pop_front();
+        lock.unlock();
+
+        job();
+    }
+}
+
+} // namespace sdbus::internal
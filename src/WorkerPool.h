@@ -0,0 +1,74 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file WorkerPool.h
+ *
+ * Created on: Oct 15, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDBUS_CXX_INTERNAL_WORKERPOOL_H_
+#define SDBUS_CXX_INTERNAL_WORKERPOOL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sdbus::internal {
+
+    // A fixed-size pool of worker threads, each having its own FIFO job queue. Jobs posted
+    // with the same key always land in the same queue, so they are executed one after another
+    // in the order of posting, while jobs with different keys may run concurrently.
+    class WorkerPool
+    {
+    public:
+        explicit WorkerPool(std::size_t workerCount);
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+        WorkerPool(WorkerPool&&) = delete;
+        WorkerPool& operator=(WorkerPool&&) = delete;
+        ~WorkerPool();
+
+        void post(std::size_t key, std::function<void()> job);
+        [[nodiscard]] std::size_t size() const;
+
+    private:
+        struct Worker
+        {
+            std::mutex mutex;
+            std::condition_variable cond;
+            std::deque<std::function<void()>> jobs;
+            bool exit{};
+            std::thread thread;
+        };
+
+        static void run(Worker& worker);
+
+        std::vector<std::unique_ptr<Worker>> workers_;
+    };
+
+} // namespace sdbus::internal
+
+#endif /* SDBUS_CXX_INTERNAL_WORKERPOOL_H_ */
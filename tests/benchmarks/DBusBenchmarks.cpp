@@ -0,0 +1,553 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file DBusBenchmarks.cpp
+ *
+ * Created on: Oct 16, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sdbus-c++/sdbus-c++.h>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <linux/perf_event.h>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+// End-to-end benchmarks of method calls and signals. They run over a direct peer-to-peer connection
+// established through a socket pair, so they need neither a bus daemon nor any bus policy configuration,
+// and their results are not skewed by the daemon relaying the messages.
+
+namespace {
+
+const sdbus::ObjectPath OBJECT_PATH{"/org/sdbuscpp/benchmarks"};
+const sdbus::InterfaceName INTERFACE_NAME{"org.sdbuscpp.benchmarks"};
+const sdbus::MethodName ECHO_METHOD{"echo"};
+const sdbus::MethodName CONSUME_ARRAY_METHOD{"consumeArray"};
+const sdbus::MethodName CONSUME_MEMFD_ARRAY_METHOD{"consumeMemfdArray"};
+const sdbus::SignalName TICK_SIGNAL{"tick"};
+
+// Reads one byte of each memory page of the data, as a consumer of large payloads would touch every page
+uint64_t touchPages(const uint8_t* data, std::size_t size)
+{
+    constexpr std::size_t pageSize{4096};
+    uint64_t sum{};
+    for (std::size_t i = 0; i < size; i += pageSize)
+        sum += data[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return sum;
+}
+
+// A server connection with an object, and a client connection with a proxy to that object,
+// both running their event loops in separate threads. Created once and shared by all benchmarks.
+class PeerToPeerEnvironment
+{
+public:
+    explicit PeerToPeerEnvironment(bool demultiplexSignals = false, bool ioUringEventLoop = false)
+    {
+        int fds[2]{}; // NOLINT(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+        [[maybe_unused]] auto r = socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds);
+        assert(r == 0);
+
+        // Both sides must run their authentication handshake at the same time
+        std::exception_ptr serverError;
+        std::thread serverThread([&]()
+        {
+            try
+            {
+                serverConnection = sdbus::createServerBus(fds[0]);
+                if (ioUringEventLoop)
+                    serverConnection->enableIoUringEventLoop();
+                serverConnection->enterEventLoopAsync();
+            }
+            catch (...)
+            {
+                serverError = std::current_exception();
+            }
+        });
+        clientConnection = sdbus::createDirectBusConnection(fds[1]);
+        if (demultiplexSignals)
+            clientConnection->enableSignalDemultiplexing(OBJECT_PATH);
+        serverThread.join();
+        if (serverError)
+            std::rethrow_exception(serverError);
+        if (ioUringEventLoop)
+            clientConnection->enableIoUringEventLoop();
+        clientConnection->enterEventLoopAsync();
+
+        object = sdbus::createObject(*serverConnection, OBJECT_PATH);
+        object->addVTable( sdbus::registerMethod(ECHO_METHOD).implementedAs([](const std::string& data){ return data; })
+                         , sdbus::registerMethod(CONSUME_ARRAY_METHOD).implementedAs([](const std::vector<uint8_t>& data){ return touchPages(data.data(), data.size()); })
+                         , sdbus::registerMethod(CONSUME_MEMFD_ARRAY_METHOD).implementedAs([](const sdbus::MemfdArray<uint8_t>& data){ return touchPages(data.data(), data.size()); })
+                         , sdbus::registerSignal(TICK_SIGNAL).withParameters<uint32_t>() ).forInterface(INTERFACE_NAME);
+
+        // Destination can be empty in case of direct connections
+        proxy = sdbus::createProxy(*clientConnection, sdbus::ServiceName{}, OBJECT_PATH);
+    }
+
+    PeerToPeerEnvironment(const PeerToPeerEnvironment&) = delete;
+    PeerToPeerEnvironment& operator=(const PeerToPeerEnvironment&) = delete;
+    PeerToPeerEnvironment(PeerToPeerEnvironment&&) = delete;
+    PeerToPeerEnvironment& operator=(PeerToPeerEnvironment&&) = delete;
+
+    ~PeerToPeerEnvironment()
+    {
+        proxy.reset();
+        object.reset();
+        if (clientConnection)
+            clientConnection->leaveEventLoop();
+        if (serverConnection)
+            serverConnection->leaveEventLoop();
+    }
+
+    std::unique_ptr<sdbus::IConnection> serverConnection;
+    std::unique_ptr<sdbus::IConnection> clientConnection;
+    std::unique_ptr<sdbus::IObject> object;
+    std::unique_ptr<sdbus::IProxy> proxy;
+};
+
+PeerToPeerEnvironment& environment(bool demultiplexSignals = false)
+{
+    if (demultiplexSignals)
+    {
+        static PeerToPeerEnvironment demultiplexingEnv{true};
+        return demultiplexingEnv;
+    }
+
+    static PeerToPeerEnvironment env;
+    return env;
+}
+
+// Reports latency percentiles (in microseconds) as user counters, so they show up in the JSON output
+void reportLatencyPercentiles(benchmark::State& state, std::vector<double>& latencies)
+{
+    if (latencies.empty())
+        return;
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p)
+    {
+        auto index = static_cast<std::size_t>(p * static_cast<double>(latencies.size() - 1));
+        return latencies[index];
+    };
+
+    state.counters["p50_us"] = percentile(0.50);
+    state.counters["p90_us"] = percentile(0.90);
+    state.counters["p99_us"] = percentile(0.99);
+    state.counters["max_us"] = latencies.back();
+}
+
+// Latency of a synchronous method call round trip, with the payload size given by the benchmark argument
+void syncCallLatency(benchmark::State& state)
+{
+    auto& env = environment();
+    const std::string payload(static_cast<std::size_t>(state.range(0)), 'x');
+    std::vector<double> latencies;
+
+    for (auto _ : state)
+    {
+        auto startTime = std::chrono::steady_clock::now();
+        std::string result;
+        env.proxy->callMethod(ECHO_METHOD).onInterface(INTERFACE_NAME).withArguments(payload).storeResultsTo(result);
+        auto stopTime = std::chrono::steady_clock::now();
+
+        latencies.push_back(std::chrono::duration<double, std::micro>(stopTime - startTime).count());
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+    reportLatencyPercentiles(state, latencies);
+}
+
+// Issues the given number of asynchronous method calls, keeping the given number of them in flight,
+// and waits for all of them to complete
+void runAsyncCalls(sdbus::IProxy& proxy, unsigned int callsInFlight, unsigned int callCount)
+{
+    const std::string payload(16, 'x');
+    std::mutex mutex;
+    std::condition_variable cond;
+    unsigned int issuedCalls{};
+    unsigned int completedCalls{};
+
+    std::function<void()> issueCall = [&]()
+    {
+        proxy.callMethodAsync(ECHO_METHOD).onInterface(INTERFACE_NAME).withArguments(payload).uponReplyInvoke([&](std::optional<sdbus::Error> /*error*/, const std::string& /*result*/)
+        {
+            std::unique_lock lock(mutex);
+            if (++completedCalls == callCount)
+                cond.notify_one();
+            if (issuedCalls == callCount)
+                return;
+            ++issuedCalls;
+            lock.unlock();
+            issueCall();
+        });
+    };
+
+    for (unsigned int i = 0; i < std::min(callsInFlight, callCount); ++i)
+    {
+        {
+            const std::lock_guard lock(mutex);
+            ++issuedCalls;
+        }
+        issueCall();
+    }
+
+    std::unique_lock lock(mutex);
+    cond.wait(lock, [&](){ return completedCalls == callCount; });
+}
+
+// Throughput of asynchronous method calls, keeping the number of calls given by the benchmark argument in flight.
+// One iteration is a batch of calls, so the items/s figure is the number of completed calls per second.
+void asyncCallThroughput(benchmark::State& state)
+{
+    constexpr unsigned int callsPerIteration{1000};
+    auto& env = environment();
+    const auto callsInFlight = static_cast<unsigned int>(state.range(0));
+
+    for (auto _ : state)
+        runAsyncCalls(*env.proxy, callsInFlight, callsPerIteration);
+
+    state.SetItemsProcessed(state.iterations() * callsPerIteration);
+}
+
+// Counts system calls made by the process, by the threads existing at the time of construction and by all threads
+// created afterwards. Needs access to the raw_syscalls tracepoint (typically root with tracefs mounted).
+class SyscallCounter
+{
+public:
+    SyscallCounter()
+    {
+        std::ifstream tracepointIdFile("/sys/kernel/tracing/events/raw_syscalls/sys_enter/id");
+        uint64_t tracepointId{};
+        if (!(tracepointIdFile >> tracepointId))
+            return;
+
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_TRACEPOINT;
+        attr.size = sizeof(attr);
+        attr.config = tracepointId;
+        attr.inherit = 1;
+        fd_ = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC));
+    }
+
+    SyscallCounter(const SyscallCounter&) = delete;
+    SyscallCounter& operator=(const SyscallCounter&) = delete;
+    SyscallCounter(SyscallCounter&&) = delete;
+    SyscallCounter& operator=(SyscallCounter&&) = delete;
+
+    ~SyscallCounter()
+    {
+        if (fd_ >= 0)
+            close(fd_);
+    }
+
+    [[nodiscard]] bool isAvailable() const
+    {
+        return fd_ >= 0;
+    }
+
+    [[nodiscard]] uint64_t count() const
+    {
+        uint64_t value{};
+        if (fd_ < 0 || read(fd_, &value, sizeof(value)) != sizeof(value))
+            return 0;
+        return value;
+    }
+
+private:
+    int fd_{-1};
+};
+
+// Throughput of asynchronous method calls with the poll() based event loop, or with the io_uring based one,
+// as given by the benchmark argument. Both client and server connections use the same kind of event loop.
+// The items/s figure is the number of completed calls (two messages each) per second. If the system call
+// counter is available, the number of system calls per call made in all threads is reported as well.
+void eventLoopThroughput(benchmark::State& state)
+{
+    constexpr unsigned int callsPerIteration{1000};
+    constexpr unsigned int callsInFlight{100};
+
+    // Threads of the connections must be created after the counter, so that they are counted too
+    const SyscallCounter syscallCounter;
+    std::unique_ptr<PeerToPeerEnvironment> env;
+    try
+    {
+        env = std::make_unique<PeerToPeerEnvironment>(false, state.range(0) != 0);
+    }
+    catch (const sdbus::Error& e)
+    {
+        state.SkipWithError(e.getMessage().c_str());
+        return;
+    }
+
+    const auto syscallsAtStart = syscallCounter.count();
+    for (auto _ : state)
+        runAsyncCalls(*env->proxy, callsInFlight, callsPerIteration);
+    const auto syscallsAtEnd = syscallCounter.count();
+
+    state.SetItemsProcessed(state.iterations() * callsPerIteration);
+    if (syscallCounter.isAvailable())
+        state.counters["syscalls_per_call"] = static_cast<double>(syscallsAtEnd - syscallsAtStart)
+                                            / static_cast<double>(state.iterations() * callsPerIteration);
+}
+
+// Delivery of signals to the number of subscribers given by the benchmark argument.
+// The items/s figure is the number of signal deliveries (signals times subscribers) per second.
+void signalFanOut(benchmark::State& state)
+{
+    constexpr uint32_t signalsPerIteration{100};
+    auto& env = environment();
+    const auto subscriberCount = static_cast<std::size_t>(state.range(0));
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::size_t deliveries{};
+
+    std::vector<std::unique_ptr<sdbus::IProxy>> subscribers;
+    for (std::size_t i = 0; i < subscriberCount; ++i)
+    {
+        auto subscriber = sdbus::createProxy(*env.clientConnection, sdbus::ServiceName{}, OBJECT_PATH);
+        subscriber->uponSignal(TICK_SIGNAL).onInterface(INTERFACE_NAME).call([&](uint32_t /*tick*/)
+        {
+            const std::lock_guard lock(mutex);
+            ++deliveries;
+            cond.notify_one();
+        });
+        subscribers.push_back(std::move(subscriber));
+    }
+
+    for (auto _ : state)
+    {
+        {
+            const std::lock_guard lock(mutex);
+            deliveries = 0;
+        }
+
+        for (uint32_t i = 0; i < signalsPerIteration; ++i)
+            env.object->emitSignal(TICK_SIGNAL).onInterface(INTERFACE_NAME).withArguments(i);
+
+        std::unique_lock lock(mutex);
+        cond.wait(lock, [&](){ return deliveries == signalsPerIteration * subscriberCount; });
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * signalsPerIteration * subscriberCount));
+}
+
+// Delivery of signals emitted by one of many objects, each of which is observed by its own proxy, as is the case
+// with per-device objects. The benchmark arguments are the number of objects, and whether the client connection
+// demultiplexes signals itself, instead of having a match rule per proxy.
+void signalDispatchAmongManyObjects(benchmark::State& state)
+{
+    constexpr uint32_t signalsPerIteration{100};
+    const auto objectCount = static_cast<std::size_t>(state.range(0));
+    auto& env = environment(state.range(1) != 0);
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::size_t deliveries{};
+
+    auto devicePath = [](std::size_t index){ return sdbus::ObjectPath{OBJECT_PATH + "/device" + std::to_string(index)}; };
+
+    std::vector<std::unique_ptr<sdbus::IProxy>> proxies;
+    proxies.reserve(objectCount);
+    for (std::size_t i = 0; i < objectCount; ++i)
+    {
+        auto proxy = sdbus::createProxy(*env.clientConnection, sdbus::ServiceName{}, devicePath(i));
+        proxy->uponSignal(TICK_SIGNAL).onInterface(INTERFACE_NAME).call([&](uint32_t /*tick*/)
+        {
+            const std::lock_guard lock(mutex);
+            ++deliveries;
+            cond.notify_one();
+        });
+        proxies.push_back(std::move(proxy));
+    }
+
+    // The most recently registered object emits the signals
+    auto device = sdbus::createObject(*env.serverConnection, devicePath(objectCount - 1));
+    device->addVTable(sdbus::registerSignal(TICK_SIGNAL).withParameters<uint32_t>()).forInterface(INTERFACE_NAME);
+
+    for (auto _ : state)
+    {
+        {
+            const std::lock_guard lock(mutex);
+            deliveries = 0;
+        }
+
+        for (uint32_t i = 0; i < signalsPerIteration; ++i)
+            device->emitSignal(TICK_SIGNAL).onInterface(INTERFACE_NAME).withArguments(i);
+
+        std::unique_lock lock(mutex);
+        cond.wait(lock, [&](){ return deliveries == signalsPerIteration; });
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * signalsPerIteration));
+}
+
+// A fire-and-forget coroutine type, the coroutine frame is destroyed once the coroutine finishes
+struct DetachedCoroutine
+{
+    struct promise_type
+    {
+        DetachedCoroutine get_return_object() const noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+};
+
+void burnCpu(std::chrono::microseconds duration)
+{
+    auto until = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < until)
+        ;
+}
+
+// Latency of a method call issued right after a burst of method calls awaited by coroutines, which run
+// CPU-heavy code once resumed. The latency is measured from the start of the burst.
+// The benchmark argument tells whether the coroutines are resumed on a thread pool executor, or directly
+// in the event loop thread of the client connection, which then can't dispatch the reply to our call
+// until the coroutines have suspended or finished.
+void awaitableContinuationLatency(benchmark::State& state)
+{
+    constexpr std::size_t coroutinesPerIteration{8};
+    constexpr std::chrono::microseconds workPerCoroutine{1000};
+    auto& env = environment();
+    static const auto executor = sdbus::createThreadPoolExecutor(coroutinesPerIteration);
+    auto* continuationExecutor = state.range(0) != 0 ? executor.get() : nullptr;
+    const std::string payload(16, 'x');
+    std::vector<double> latencies;
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::size_t finished{};
+    std::optional<std::chrono::steady_clock::time_point> replyTime;
+
+    auto coroutine = [&]() -> DetachedCoroutine
+    {
+        auto awaitable = env.proxy->callMethodAsync(ECHO_METHOD).onInterface(INTERFACE_NAME).withArguments(payload).getResultAsAwaitable<std::string>();
+        if (continuationExecutor != nullptr)
+            awaitable.resumeOn(*continuationExecutor);
+        auto result = co_await awaitable;
+        benchmark::DoNotOptimize(result);
+
+        burnCpu(workPerCoroutine);
+
+        const std::lock_guard lock(mutex);
+        ++finished;
+        cond.notify_all();
+    };
+
+    for (auto _ : state)
+    {
+        {
+            const std::lock_guard lock(mutex);
+            finished = 0;
+            replyTime.reset();
+        }
+
+        auto startTime = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < coroutinesPerIteration; ++i)
+            coroutine();
+
+        env.proxy->callMethodAsync(ECHO_METHOD).onInterface(INTERFACE_NAME).withArguments(payload).uponReplyInvoke([&](std::optional<sdbus::Error> /*error*/, const std::string& /*result*/)
+        {
+            const std::lock_guard lock(mutex);
+            replyTime = std::chrono::steady_clock::now();
+            cond.notify_all();
+        });
+
+        std::unique_lock lock(mutex);
+        cond.wait(lock, [&](){ return replyTime.has_value() && finished == coroutinesPerIteration; });
+        latencies.push_back(std::chrono::duration<double, std::micro>(*replyTime - startTime).count());
+    }
+
+    reportLatencyPercentiles(state, latencies);
+}
+
+// Synchronous method call passing a large byte array of the size (in MiB) given by the first benchmark argument,
+// either as a plain D-Bus array or as a MemfdArray, as given by the second argument. The array already exists on
+// the client side; the server touches each of its pages.
+void largeArrayTransfer(benchmark::State& state)
+{
+    // sd-bus refuses to receive messages larger than 128 MiB, and fails the whole connection on such a message
+    constexpr std::size_t maxPlainArraySize{64U << 20U};
+
+    auto& env = environment();
+    const auto size = static_cast<std::size_t>(state.range(0)) << 20U;
+    const bool useMemfd = state.range(1) != 0;
+    if (!useMemfd && size > maxPlainArraySize)
+    {
+        state.SkipWithError("Plain D-Bus arrays of this size exceed sd-bus message size limit");
+        return;
+    }
+    const std::vector<uint8_t> payload(size, 0x5a);
+
+    try
+    {
+        for (auto _ : state)
+        {
+            uint64_t result{};
+            if (useMemfd)
+                env.proxy->callMethod(CONSUME_MEMFD_ARRAY_METHOD).onInterface(INTERFACE_NAME).withArguments(sdbus::MemfdArray<uint8_t>{payload}).storeResultsTo(result);
+            else
+                env.proxy->callMethod(CONSUME_ARRAY_METHOD).onInterface(INTERFACE_NAME).withArguments(payload).storeResultsTo(result);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    catch (const sdbus::Error& e)
+    {
+        state.SkipWithError(e.getMessage().c_str());
+        return;
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size));
+}
+
+} // namespace
+
+// NOLINTBEGIN(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+
+BENCHMARK(syncCallLatency)->Arg(16)->Arg(1024)->Arg(64 << 10)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(asyncCallThroughput)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(eventLoopThroughput)->Arg(0)->Arg(1)->ArgName("io_uring")->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(signalFanOut)->Arg(1)->Arg(8)->Arg(64)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(signalDispatchAmongManyObjects)->ArgsProduct({{1, 100, 10000}, {0, 1}})->ArgNames({"objects", "demux"})->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(largeArrayTransfer)->ArgsProduct({{1, 4, 16, 64, 256}, {0, 1}})->ArgNames({"MiB", "memfd"})->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(awaitableContinuationLatency)->Arg(0)->Arg(1)->ArgName("executor")->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+// NOLINTEND(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
@@ -0,0 +1,185 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file SerializationBenchmarks.cpp
+ *
+ * Created on: Oct 16, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sdbus-c++/sdbus-c++.h>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+// Microbenchmarks of (de)serialization of all type families supported by sdbus-c++. No bus is involved;
+// values are serialized into and deserialized from a local plain message. The benchmark argument, where
+// present, is the number of elements of the container (or the length of the string).
+
+namespace {
+
+using IntStringDoubleStruct = sdbus::Struct<int32_t, std::string, double>;
+using Int32Struct = sdbus::Struct<int32_t, int32_t>;
+using DoubleStruct = sdbus::Struct<double, double>;
+using Properties = std::map<std::string, sdbus::Variant>;
+using StdVariant = std::variant<int32_t, std::string, double>;
+
+template <typename Factory>
+void serialize(benchmark::State& state, Factory factory)
+{
+    const auto value = factory(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        auto msg = sdbus::createPlainMessage();
+        msg << value;
+        benchmark::DoNotOptimize(msg);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Factory>
+void deserialize(benchmark::State& state, Factory factory)
+{
+    const auto value = factory(static_cast<std::size_t>(state.range(0)));
+    auto msg = sdbus::createPlainMessage();
+    msg << value;
+    msg.seal();
+
+    for (auto _ : state)
+    {
+        msg.rewind(true);
+        decltype(factory(0)) result{};
+        msg >> result;
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+Properties makeProperties(std::size_t size)
+{
+    Properties properties;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        auto name = "Property" + std::to_string(i);
+        switch (i % 4)
+        {
+            case 0: properties.emplace(std::move(name), sdbus::Variant{static_cast<uint32_t>(i)}); break;
+            case 1: properties.emplace(std::move(name), sdbus::Variant{i % 2 == 0}); break;
+            case 2: properties.emplace(std::move(name), sdbus::Variant{"value" + std::to_string(i)}); break;
+            default: properties.emplace(std::move(name), sdbus::Variant{std::vector<int32_t>{1, 2, 3}}); break;
+        }
+    }
+    return properties;
+}
+
+const auto makeBool = [](std::size_t /*size*/){ return true; };
+const auto makeInt32 = [](std::size_t /*size*/){ return int32_t{42}; };
+const auto makeUint64 = [](std::size_t /*size*/){ return uint64_t{42}; };
+const auto makeDouble = [](std::size_t /*size*/){ return 3.14; };
+const auto makeString = [](std::size_t size){ return std::string(size, 'x'); };
+const auto makeObjectPath = [](std::size_t /*size*/){ return sdbus::ObjectPath{"/org/sdbuscpp/benchmarks/object"}; };
+const auto makeSignature = [](std::size_t /*size*/){ return sdbus::Signature{"a{sv}"}; };
+const auto makeBasicVariant = [](std::size_t /*size*/){ return sdbus::Variant{uint32_t{42}}; };
+const auto makeStringVariant = [](std::size_t /*size*/){ return sdbus::Variant{std::string{"org.sdbuscpp.benchmarks"}}; };
+const auto makeContainerVariant = [](std::size_t size){ return sdbus::Variant{std::vector<int32_t>(size, 42)}; };
+const auto makeStdVariant = [](std::size_t /*size*/){ return StdVariant{std::string{"org.sdbuscpp.benchmarks"}}; };
+const auto makeStruct = [](std::size_t /*size*/){ return IntStringDoubleStruct{42, "org.sdbuscpp.benchmarks", 3.14}; };
+const auto makeTuple = [](std::size_t /*size*/){ return std::tuple<int32_t, std::string, double>{42, "org.sdbuscpp.benchmarks", 3.14}; };
+const auto makeInt32Array = [](std::size_t size){ return std::vector<int32_t>(size, 42); };
+const auto makeBoolArray = [](std::size_t size){ return std::vector<bool>(size, true); };
+const auto makeStringArray = [](std::size_t size){ return std::vector<std::string>(size, "org.sdbuscpp.benchmarks"); };
+const auto makeStructArray = [](std::size_t size){ return std::vector<Int32Struct>(size, Int32Struct{1, 2}); };
+const auto makeDoubleStructArray = [](std::size_t size){ return std::vector<DoubleStruct>(size, DoubleStruct{1.0, 2.0}); };
+const auto makeMap = [](std::size_t size)
+{
+    std::map<int32_t, std::string> map;
+    for (std::size_t i = 0; i < size; ++i)
+        map.emplace(static_cast<int32_t>(i), "value");
+    return map;
+};
+const auto makeUnorderedMap = [](std::size_t size)
+{
+    std::unordered_map<int32_t, std::string> map;
+    for (std::size_t i = 0; i < size; ++i)
+        map.emplace(static_cast<int32_t>(i), "value");
+    return map;
+};
+
+} // namespace
+
+// NOLINTBEGIN(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
+
+BENCHMARK_CAPTURE(serialize, bool, makeBool)->Arg(1);
+BENCHMARK_CAPTURE(deserialize, bool, makeBool)->Arg(1);
+BENCHMARK_CAPTURE(serialize, int32, makeInt32)->Arg(1);
+BENCHMARK_CAPTURE(deserialize, int32, makeInt32)->Arg(1);
+BENCHMARK_CAPTURE(serialize, uint64, makeUint64)->Arg(1);
+BENCHMARK_CAPTURE(deserialize, uint64, makeUint64)->Arg(1);
+BENCHMARK_CAPTURE(serialize, double, makeDouble)->Arg(1);
+BENCHMARK_CAPTURE(deserialize, double, makeDouble)->Arg(1);
+BENCHMARK_CAPTURE(serialize, string, makeString)->Range(8, 64 << 10);
+BENCHMARK_CAPTURE(deserialize, string, makeString)->Range(8, 64 << 10);
+BENCHMARK_CAPTURE(serialize, object_path, makeObjectPath)->Arg(1);
+BENCHMARK_CAPTURE(deserialize, object_path, makeObjectPath)->Arg(1);
+BENCHMARK_CAPTURE(serialize, signature, makeSignature)->Arg(1);
+BENCHMARK_CAPTURE(deserialize, signature, makeSignature)->Arg(1);
+
+BENCHMARK_CAPTURE(serialize, variant_basic, makeBasicVariant)->Arg(1);
+BENCHMARK_CAPTURE(deserialize, variant_basic, makeBasicVariant)->Arg(1);
+BENCHMARK_CAPTURE(serialize, variant_string, makeStringVariant)->Arg(1);
+BENCHMARK_CAPTURE(deserialize, variant_string, makeStringVariant)->Arg(1);
+BENCHMARK_CAPTURE(serialize, variant_container, makeContainerVariant)->Range(8, 8 << 10);
+BENCHMARK_CAPTURE(deserialize, variant_container, makeContainerVariant)->Range(8, 8 << 10);
+BENCHMARK_CAPTURE(serialize, std_variant, makeStdVariant)->Arg(1);
+BENCHMARK_CAPTURE(deserialize, std_variant, makeStdVariant)->Arg(1);
+
+BENCHMARK_CAPTURE(serialize, struct, makeStruct)->Arg(1);
+BENCHMARK_CAPTURE(deserialize, struct, makeStruct)->Arg(1);
+BENCHMARK_CAPTURE(serialize, tuple, makeTuple)->Arg(1);
+BENCHMARK_CAPTURE(deserialize, tuple, makeTuple)->Arg(1);
+
+BENCHMARK_CAPTURE(serialize, array_of_int32, makeInt32Array)->Range(8, 64 << 10);
+BENCHMARK_CAPTURE(deserialize, array_of_int32, makeInt32Array)->Range(8, 64 << 10);
+BENCHMARK_CAPTURE(serialize, array_of_bool, makeBoolArray)->Range(8, 8 << 10);
+BENCHMARK_CAPTURE(deserialize, array_of_bool, makeBoolArray)->Range(8, 8 << 10);
+BENCHMARK_CAPTURE(serialize, array_of_string, makeStringArray)->Range(8, 8 << 10);
+BENCHMARK_CAPTURE(deserialize, array_of_string, makeStringArray)->Range(8, 8 << 10);
+BENCHMARK_CAPTURE(serialize, array_of_struct, makeStructArray)->Range(8, 8 << 10);
+BENCHMARK_CAPTURE(deserialize, array_of_struct, makeStructArray)->Range(8, 8 << 10);
+BENCHMARK_CAPTURE(serialize, array_of_double_struct, makeDoubleStructArray)->Range(8, 128 << 10);
+BENCHMARK_CAPTURE(deserialize, array_of_double_struct, makeDoubleStructArray)->Range(8, 128 << 10);
+
+BENCHMARK_CAPTURE(serialize, map, makeMap)->Range(8, 8 << 10);
+BENCHMARK_CAPTURE(deserialize, map, makeMap)->Range(8, 8 << 10);
+BENCHMARK_CAPTURE(serialize, unordered_map, makeUnorderedMap)->Range(8, 8 << 10);
+BENCHMARK_CAPTURE(deserialize, unordered_map, makeUnorderedMap)->Range(8, 8 << 10);
+BENCHMARK_CAPTURE(serialize, properties_dictionary, makeProperties)->Range(8, 1 << 10);
+BENCHMARK_CAPTURE(deserialize, properties_dictionary, makeProperties)->Range(8, 1 << 10);
+
+// NOLINTEND(cert-err58-cpp,cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-owning-memory)
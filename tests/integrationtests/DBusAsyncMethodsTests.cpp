@@ -115,6 +115,35 @@ TYPED_TEST(AsyncSdbusTestObject, RunsServerSideAsynchronousMethodAsynchronously)
     ASSERT_THAT(results, ElementsAre(500, 1000, 1500));
 }
 
+TYPED_TEST(AsyncSdbusTestObject, RunsServerSideCoroutineMethodWithoutBlockingTheEventLoop)
+{
+    std::mutex mtx;
+    std::vector<uint32_t> results;
+    std::atomic invoke{false};
+    std::atomic startedCount{0};
+    auto call = [&](uint32_t param)
+    {
+        TestProxy proxy{SERVICE_NAME, OBJECT_PATH};
+        ++startedCount;
+        while (!invoke) ;
+        auto result = proxy.doOperationCoroutine(param);
+        std::lock_guard const guard(mtx);
+        results.push_back(result);
+    };
+
+    std::thread invocations[]{std::thread{call, 900}, std::thread{call, 600}, std::thread{call, 300}};
+    while (startedCount != 3) ;
+    invoke = true;
+    std::for_each(std::begin(invocations), std::end(invocations), [](auto& thread){ thread.join(); });
+
+    ASSERT_THAT(results, ElementsAre(300, 600, 900));
+}
+
+TYPED_TEST(AsyncSdbusTestObject, ReturnsErrorReplyWhenServerSideCoroutineMethodThrows)
+{
+    ASSERT_THROW(this->m_proxy->doOperationCoroutine(0), sdbus::Error);
+}
+
 TYPED_TEST(AsyncSdbusTestObject, HandlesCorrectlyABulkOfParallelServerSideAsyncMethods)
 {
     std::atomic<size_t> resultCount{};
@@ -182,6 +211,20 @@ TYPED_TEST(AsyncSdbusTestObject, InvokesMethodAsynchronouslyOnClientSideWithFutu
     ASSERT_THAT(future.get(), Eq(100));
 }
 
+TYPED_TEST(AsyncSdbusTestObject, InvokesBatchOfMethodsAsynchronouslyOnClientSide)
+{
+    std::vector<std::future<uint32_t>> futures;
+
+    {
+        auto batch = this->s_proxyConnection->startBatch();
+        for (uint32_t i = 0; i < 100; ++i)
+            futures.push_back(this->m_proxy->doOperationClientSideAsync(i, sdbus::with_future));
+    }
+
+    for (uint32_t i = 0; i < 100; ++i)
+        ASSERT_THAT(futures[i].get(), Eq(i));
+}
+
 TYPED_TEST(AsyncSdbusTestObject, InvokesMethodAsynchronouslyOnClientSideWithFutureOnBasicAPILevel)
 {
     auto future = this->m_proxy->doOperationClientSideAsyncOnBasicAPILevel(100);
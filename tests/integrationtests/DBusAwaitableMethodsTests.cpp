@@ -25,12 +25,16 @@
  * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <atomic>
 #include <coroutine>
 #include <cstdint>
 #include <exception>
+#include <functional>
 #include <future>
 #include <map>
+#include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 
 #include <sdbus-c++/sdbus-c++.h>
@@ -158,6 +162,25 @@ struct Task<void> {
     void get() { handle.promise().future.get(); } // NOLINT(readability-make-member-function-const)
 };
 
+// Runs jobs on a single-threaded pool and remembers which thread ran them
+class RecordingExecutor : public sdbus::IExecutor
+{
+public:
+    void post(std::function<void()> job) override
+    {
+        pool_->post([this, job = std::move(job)]()
+        {
+            jobThreadId = std::this_thread::get_id();
+            job();
+        });
+    }
+
+    std::atomic<std::thread::id> jobThreadId;
+
+private:
+    std::unique_ptr<sdbus::IExecutor> pool_{sdbus::createThreadPoolExecutor(1)};
+};
+
 /*-------------------------------------*/
 /* --          TEST CASES           -- */
 /*-------------------------------------*/
@@ -245,3 +268,20 @@ TYPED_TEST(AsyncSdbusTestObject, AwaitablePropagatesExceptionsCorrectly)
 
     ASSERT_THAT(task.get(), ::testing::HasSubstr("Error"));
 }
+
+TYPED_TEST(AsyncSdbusTestObject, ResumesAwaitingCoroutineOnAttachedExecutor)
+{
+    RecordingExecutor executor;
+
+    auto task = [](TestProxy* proxy, sdbus::IExecutor& executor) -> Task<std::thread::id> {
+        auto result = co_await proxy->doOperationClientSideAsync(100, sdbus::with_awaitable).resumeOn(executor);
+        EXPECT_THAT(result, Eq(100));
+        co_return std::this_thread::get_id();
+    }(this->m_proxy.get(), executor);
+
+    task.resume();
+
+    auto continuationThreadId = task.get();
+    ASSERT_THAT(continuationThreadId, Eq(executor.jobThreadId.load()));
+    ASSERT_THAT(continuationThreadId, ::testing::Ne(std::this_thread::get_id()));
+}
@@ -26,17 +26,27 @@
 
 // Own
 #include "Defs.h"
+#include "TestFixture.h"
 
 // sdbus
 #include <sdbus-c++/Error.h>
 #include <sdbus-c++/IConnection.h>
+#include <sdbus-c++/sdbus-c++.h>
 
 // gmock
 #include <gtest/gtest.h>
+#include <gmock/gmock.h>
 
 // STL
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <numeric>
 #include <thread>
+#include <vector>
 
+using ::testing::Eq;
+using namespace std::chrono_literals;
 using namespace sdbus::test;
 
 /*-------------------------------------*/
@@ -91,3 +101,311 @@ TEST(Connection, CanEnterAndLeaveInternalEventLoop)
 
     t.join();
 }
+
+TEST(Connection, ThrowsErrorWhenEnablingMultithreadedDispatchWithZeroWorkers)
+{
+    auto connection = sdbus::createBusConnection();
+
+    ASSERT_THROW(connection->enableMultithreadedDispatch(0), sdbus::Error);
+}
+
+TEST(Connection, ThrowsErrorWhenEnablingMultithreadedDispatchTwice)
+{
+    auto connection = sdbus::createBusConnection();
+    connection->enableMultithreadedDispatch(2);
+
+    ASSERT_THROW(connection->enableMultithreadedDispatch(2), sdbus::Error);
+}
+
+TEST(Connection, KeepsProcessingIncomingMessagesWhileMethodHandlerRunsInMultithreadedDispatchMode)
+{
+    auto connection = sdbus::createBusConnection();
+    connection->requestName(SERVICE_NAME);
+    connection->enableMultithreadedDispatch(2);
+
+    // The method handler waits for the property getter, which is served by the event loop thread.
+    // With serial dispatch the getter would only get a chance to run after the handler has timed out.
+    std::atomic<bool> getterCalled{false};
+    auto object = sdbus::createObject(*connection, OBJECT_PATH);
+    object->addVTable( sdbus::registerMethod("waitForGetter").implementedAs([&]()
+                       {
+                           auto deadline = std::chrono::steady_clock::now() + 2s;
+                           while (!getterCalled && std::chrono::steady_clock::now() < deadline)
+                               std::this_thread::sleep_for(1ms);
+                           return getterCalled.load();
+                       })
+                     , sdbus::registerProperty("state").withGetter([&](){ getterCalled = true; return true; }) ).forInterface(INTERFACE_NAME);
+    connection->enterEventLoopAsync();
+
+    bool result{};
+    std::thread client([&]()
+    {
+        auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
+        proxy->callMethod("waitForGetter").onInterface(INTERFACE_NAME).storeResultsTo(result);
+    });
+    auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
+    proxy->getProperty("state").onInterface(INTERFACE_NAME);
+    client.join();
+
+    ASSERT_TRUE(result);
+}
+
+TEST(Connection, HandlesMethodCallsOnTheSameObjectSeriallyInPerObjectDispatchMode)
+{
+    auto connection = sdbus::createBusConnection();
+    connection->requestName(SERVICE_NAME);
+    connection->enableMultithreadedDispatch(4, sdbus::DispatchOrdering::PerObject);
+
+    std::atomic<int> runningHandlers{0};
+    std::atomic<int> maxRunningHandlers{0};
+    auto object = sdbus::createObject(*connection, OBJECT_PATH);
+    object->addVTable(sdbus::registerMethod("doWork").implementedAs([&]()
+    {
+        auto running = ++runningHandlers;
+        if (running > maxRunningHandlers)
+            maxRunningHandlers = running;
+        std::this_thread::sleep_for(10ms);
+        --runningHandlers;
+    })).forInterface(INTERFACE_NAME);
+    connection->enterEventLoopAsync();
+
+    std::vector<std::thread> clients;
+    for (int i = 0; i < 4; ++i)
+        clients.emplace_back([&]()
+        {
+            auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
+            proxy->callMethod("doWork").onInterface(INTERFACE_NAME);
+        });
+    for (auto& client : clients)
+        client.join();
+
+    ASSERT_THAT(maxRunningHandlers.load(), Eq(1));
+}
+
+TEST(Connection, ReturnsErrorReplyFromMethodHandlerInMultithreadedDispatchMode)
+{
+    auto connection = sdbus::createBusConnection();
+    connection->requestName(SERVICE_NAME);
+    connection->enableMultithreadedDispatch(2);
+
+    auto object = sdbus::createObject(*connection, OBJECT_PATH);
+    object->addVTable(sdbus::registerMethod("throwError").implementedAs([]()
+    {
+        throw sdbus::Error(sdbus::Error::Name{"org.sdbuscpp.Error"}, "A test error");
+    })).forInterface(INTERFACE_NAME);
+    connection->enterEventLoopAsync();
+
+    auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
+    try
+    {
+        proxy->callMethod("throwError").onInterface(INTERFACE_NAME);
+        FAIL() << "Expected sdbus::Error";
+    }
+    catch (const sdbus::Error& e)
+    {
+        ASSERT_THAT(e.getName(), Eq("org.sdbuscpp.Error"));
+        ASSERT_THAT(e.getMessage(), Eq("A test error"));
+    }
+}
+
+TEST(Connection, DoesNotSerializeConcurrentSynchronousCallsWhenEventLoopRunsInAnotherThread)
+{
+    auto serverConnection = sdbus::createBusConnection();
+    serverConnection->requestName(SERVICE_NAME);
+    std::thread slowReplier;
+    auto object = sdbus::createObject(*serverConnection, OBJECT_PATH);
+    object->addVTable( sdbus::registerMethod("slow").implementedAs([&](sdbus::Result<>&& result)
+                       {
+                           slowReplier = std::thread([result = std::move(result)](){ std::this_thread::sleep_for(1s); result.returnResults(); });
+                       })
+                     , sdbus::registerMethod("fast").implementedAs([](){}) ).forInterface(INTERFACE_NAME);
+    serverConnection->enterEventLoopAsync();
+
+    auto clientConnection = sdbus::createBusConnection();
+    clientConnection->enterEventLoopAsync();
+    auto proxy = sdbus::createProxy(*clientConnection, SERVICE_NAME, OBJECT_PATH);
+
+    std::thread slowCaller([&](){ proxy->callMethod("slow").onInterface(INTERFACE_NAME); });
+    std::this_thread::sleep_for(100ms);
+    auto startTime = std::chrono::steady_clock::now();
+    proxy->callMethod("fast").onInterface(INTERFACE_NAME);
+    auto duration = std::chrono::steady_clock::now() - startTime;
+    slowCaller.join();
+    slowReplier.join();
+
+    // The fast call must not wait for the pending slow call to complete
+    ASSERT_THAT(duration < 500ms, Eq(true));
+}
+
+TEST(Connection, ServesMethodCallsAndSignalsInIoUringEventLoop)
+{
+    auto serverConnection = sdbus::createBusConnection();
+    auto clientConnection = sdbus::createBusConnection();
+    try
+    {
+        serverConnection->enableIoUringEventLoop();
+        clientConnection->enableIoUringEventLoop();
+    }
+    catch (const sdbus::Error& e)
+    {
+        GTEST_SKIP() << "io_uring event loop is not available: " << e.getMessage();
+    }
+
+    serverConnection->requestName(SERVICE_NAME);
+    auto object = sdbus::createObject(*serverConnection, OBJECT_PATH);
+    object->addVTable( sdbus::registerMethod("add").implementedAs([](uint32_t a, uint32_t b){ return a + b; })
+                     , sdbus::registerSignal("added").withParameters<uint32_t>() ).forInterface(INTERFACE_NAME);
+    serverConnection->enterEventLoopAsync();
+    clientConnection->enterEventLoopAsync();
+
+    std::atomic<uint32_t> signalValue{};
+    auto proxy = sdbus::createProxy(*clientConnection, SERVICE_NAME, OBJECT_PATH);
+    proxy->uponSignal("added").onInterface(INTERFACE_NAME).call([&](uint32_t value){ signalValue = value; });
+
+    uint32_t result{};
+    proxy->callMethod("add").onInterface(INTERFACE_NAME).withArguments(1u, 2u).storeResultsTo(result);
+    auto future = proxy->callMethodAsync("add").onInterface(INTERFACE_NAME).withArguments(3u, 4u).getResultAsFuture<uint32_t>();
+    object->emitSignal("added").onInterface(INTERFACE_NAME).withArguments(42u);
+
+    ASSERT_THAT(result, Eq(3u));
+    ASSERT_THAT(future.get(), Eq(7u));
+    ASSERT_TRUE(waitUntil([&](){ return signalValue == 42u; }));
+
+    clientConnection->leaveEventLoop();
+    serverConnection->leaveEventLoop();
+}
+
+TEST(Connection, ThrowsErrorWhenEnablingIoUringEventLoopTwice)
+{
+    auto connection = sdbus::createBusConnection();
+    try
+    {
+        connection->enableIoUringEventLoop();
+    }
+    catch (const sdbus::Error& e)
+    {
+        GTEST_SKIP() << "io_uring event loop is not available: " << e.getMessage();
+    }
+
+    ASSERT_THROW(connection->enableIoUringEventLoop(), sdbus::Error);
+}
+
+TEST(Connection, ReportsItsActivityInMetrics)
+{
+    auto serverConnection = sdbus::createBusConnection();
+    auto clientConnection = sdbus::createBusConnection();
+    serverConnection->requestName(SERVICE_NAME);
+    serverConnection->enableTimingMetrics();
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    auto object = sdbus::createObject(*serverConnection, OBJECT_PATH);
+    object->addVTable( sdbus::registerMethod("add").implementedAs([](uint32_t a, uint32_t b){ return a + b; })
+                     , sdbus::registerMethod("wait").implementedAs([released](){ released.wait(); }) ).forInterface(INTERFACE_NAME);
+    serverConnection->enterEventLoopAsync();
+    clientConnection->enterEventLoopAsync();
+    auto proxy = sdbus::createProxy(*clientConnection, SERVICE_NAME, OBJECT_PATH);
+
+    const auto matchRulesBefore = clientConnection->getMetrics().matchRules;
+    proxy->uponSignal("added").onInterface(INTERFACE_NAME).call([](uint32_t){});
+    ASSERT_THAT(clientConnection->getMetrics().matchRules, Eq(matchRulesBefore + 1));
+
+    auto future = proxy->callMethodAsync("wait").onInterface(INTERFACE_NAME).getResultAsFuture<>();
+    ASSERT_THAT(clientConnection->getMetrics().pendingAsyncCalls, Eq(1));
+    release.set_value();
+    future.get();
+    ASSERT_TRUE(waitUntil([&](){ return clientConnection->getMetrics().pendingAsyncCalls == 0; }));
+
+    uint32_t result{};
+    proxy->callMethod("add").onInterface(INTERFACE_NAME).withArguments(1u, 2u).storeResultsTo(result);
+    const auto metrics = serverConnection->getMetrics();
+    ASSERT_THAT(metrics.processedMessages >= 2, Eq(true));
+    ASSERT_THAT(metrics.dispatchTime.count() > 0, Eq(true));
+    ASSERT_THAT(metrics.pollTime.count() > 0, Eq(true));
+    const auto histogramCount = std::accumulate(metrics.dispatchTimeHistogram.begin(), metrics.dispatchTimeHistogram.end(), uint64_t{});
+    ASSERT_THAT(histogramCount >= 2, Eq(true));
+    ASSERT_THAT(clientConnection->getMetrics().dispatchTime.count(), Eq(0)); // Timing not enabled there
+
+    clientConnection->leaveEventLoop();
+    serverConnection->leaveEventLoop();
+}
+
+TEST(Connection, ServesMethodCallsAndSignalsInReactorSharedWithOtherConnections)
+{
+    auto serverConnection = sdbus::createBusConnection();
+    auto clientConnection = sdbus::createBusConnection();
+    serverConnection->requestName(SERVICE_NAME);
+    auto object = sdbus::createObject(*serverConnection, OBJECT_PATH);
+    object->addVTable( sdbus::registerMethod("add").implementedAs([](uint32_t a, uint32_t b){ return a + b; })
+                     , sdbus::registerSignal("added").withParameters<uint32_t>() ).forInterface(INTERFACE_NAME);
+    auto reactor = sdbus::createReactor();
+    reactor->attach(*serverConnection);
+    reactor->attach(*clientConnection);
+
+    std::atomic<uint32_t> signalValue{};
+    auto proxy = sdbus::createProxy(*clientConnection, SERVICE_NAME, OBJECT_PATH);
+    proxy->uponSignal("added").onInterface(INTERFACE_NAME).call([&](uint32_t value){ signalValue = value; });
+
+    uint32_t result{};
+    proxy->callMethod("add").onInterface(INTERFACE_NAME).withArguments(1u, 2u).storeResultsTo(result);
+    auto future = proxy->callMethodAsync("add").onInterface(INTERFACE_NAME).withArguments(3u, 4u).getResultAsFuture<uint32_t>();
+    object->emitSignal("added").onInterface(INTERFACE_NAME).withArguments(42u);
+
+    ASSERT_THAT(result, Eq(3u));
+    ASSERT_THAT(future.get(), Eq(7u));
+    ASSERT_TRUE(waitUntil([&](){ return signalValue == 42u; }));
+}
+
+TEST(Connection, CanBeDetachedFromReactorAndServedInItsOwnEventLoopThen)
+{
+    auto serverConnection = sdbus::createBusConnection();
+    serverConnection->requestName(SERVICE_NAME);
+    auto object = sdbus::createObject(*serverConnection, OBJECT_PATH);
+    object->addVTable(sdbus::registerMethod("add").implementedAs([](uint32_t a, uint32_t b){ return a + b; })).forInterface(INTERFACE_NAME);
+    auto reactor = sdbus::createReactor();
+    reactor->attach(*serverConnection);
+
+    reactor->detach(*serverConnection);
+    serverConnection->enterEventLoopAsync();
+
+    auto proxy = sdbus::createProxy(SERVICE_NAME, OBJECT_PATH);
+    uint32_t result{};
+    proxy->callMethod("add").onInterface(INTERFACE_NAME).withArguments(1u, 2u).storeResultsTo(result);
+    ASSERT_THAT(result, Eq(3u));
+}
+
+TEST(Connection, CanBeServedInItsOwnEventLoopAfterReactorStop)
+{
+    auto serverConnection = sdbus::createBusConnection();
+    serverConnection->requestName(SERVICE_NAME);
+    auto object = sdbus::createObject(*serverConnection, OBJECT_PATH);
+    object->addVTable(sdbus::registerMethod("add").implementedAs([](uint32_t a, uint32_t b){ return a + b; })).forInterface(INTERFACE_NAME);
+    auto reactor = sdbus::createReactor(2);
+    reactor->attach(*serverConnection);
+
+    ASSERT_NO_THROW(reactor->stop());
+    ASSERT_NO_THROW(reactor->stop());
+    reactor->detach(*serverConnection);
+    serverConnection->enterEventLoopAsync();
+
+    auto proxy = sdbus::createProxy(SERVICE_NAME, OBJECT_PATH);
+    uint32_t result{};
+    proxy->callMethod("add").onInterface(INTERFACE_NAME).withArguments(1u, 2u).storeResultsTo(result);
+    ASSERT_THAT(result, Eq(3u));
+}
+
+TEST(Connection, ThrowsErrorWhenAttachingToReactorTwice)
+{
+    auto connection = sdbus::createBusConnection();
+    auto reactor = sdbus::createReactor();
+    reactor->attach(*connection);
+
+    ASSERT_THROW(reactor->attach(*connection), sdbus::Error);
+}
+
+TEST(Connection, ThrowsErrorWhenDetachingFromReactorItIsNotAttachedTo)
+{
+    auto connection = sdbus::createBusConnection();
+    auto reactor = sdbus::createReactor();
+
+    ASSERT_THROW(reactor->detach(*connection), sdbus::Error);
+}
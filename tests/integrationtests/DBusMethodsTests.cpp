@@ -34,16 +34,21 @@
 #include <gmock/gmock.h>
 #include <map>
 #include <memory>
+#include <memory_resource>
+#include <optional>
 #include <string>
+#include <atomic>
 #include <chrono>
 #include <vector>
 #include <variant>
+#include <unistd.h>
 
 using ::testing::Eq;
 using ::testing::Gt;
 using ::testing::Le;
 using ::testing::AnyOf;
 using ::testing::NotNull;
+using ::testing::ElementsAre;
 using namespace std::chrono_literals;
 using namespace std::string_literals;
 using namespace sdbus::test;
@@ -61,6 +66,33 @@ namespace my {
 
 SDBUSCPP_REGISTER_STRUCT(my::Struct, i, s, l); // NOLINT(readability-identifier-length)
 
+namespace {
+    std::atomic<std::size_t> allocationCount{}; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    template <typename T>
+    struct CountingAllocator
+    {
+        using value_type = T;
+
+        CountingAllocator() = default;
+        template <typename U>
+        CountingAllocator(const CountingAllocator<U>& /*other*/) noexcept {} // NOLINT(google-explicit-constructor)
+
+        T* allocate(std::size_t n)
+        {
+            ++allocationCount;
+            return std::allocator<T>{}.allocate(n);
+        }
+
+        void deallocate(T* ptr, std::size_t n) noexcept
+        {
+            std::allocator<T>{}.deallocate(ptr, n);
+        }
+
+        friend bool operator==(const CountingAllocator& /*lhs*/, const CountingAllocator& /*rhs*/) { return true; }
+    };
+} // namespace
+
 /*-------------------------------------*/
 /* --          TEST CASES           -- */
 /*-------------------------------------*/
@@ -283,6 +315,18 @@ TYPED_TEST(SdbusTestObject, CanAccessAssociatedMethodCallMessageInMethodCallHand
     ASSERT_THAT(this->m_adaptor->m_methodName, Eq("doOperation"));
 }
 
+TYPED_TEST(SdbusTestObject, ProvidesCredentialsOfMethodCallSenderInOneQuery)
+{
+    this->m_proxy->doOperation(10); // This will save pointer to method call message on server side
+
+    const auto& creds = this->m_adaptor->m_methodCallMsg->getCreds(sdbus::Credentials::Pid | sdbus::Credentials::Uid | sdbus::Credentials::Gid);
+
+    ASSERT_THAT(creds.getPid(), Eq(getpid()));
+    ASSERT_THAT(creds.getUid(), Eq(getuid()));
+    ASSERT_THAT(creds.getGid(), Eq(getgid()));
+    ASSERT_THAT(this->m_adaptor->m_methodCallMsg->getCredsUid(), Eq(getuid())); // Served from the cached credentials
+}
+
 TYPED_TEST(SdbusTestObject, ProvidesSerialInMethodCallAndMethodReplyMessage)
 {
     auto reply = this->m_proxy->doOperationOnBasicAPILevel(ANY_UNSIGNED_NUMBER);
@@ -363,6 +407,94 @@ TYPED_TEST(SdbusTestObject, CanRegisterAdditionalVTableDynamicallyAtAnyTime)
     ASSERT_THAT(result, Eq(8));
 }
 
+TYPED_TEST(SdbusTestObject, DeserializesPmrArgumentsOfMethodHandlerIntoHandlerArena)
+{
+    auto& object = this->m_adaptor->getObject();
+    sdbus::InterfaceName const interfaceName{"org.sdbuscpp.integrationtests2"};
+    bool argumentsInArena{};
+    auto vtableSlot = object.addVTable( interfaceName
+                                      , { sdbus::registerMethod("concat").implementedAs([&](const std::pmr::vector<std::pmr::string>& strings)
+                                          {
+                                              argumentsInArena = strings.get_allocator().resource() != std::pmr::get_default_resource()
+                                                              && strings.at(0).get_allocator().resource() == strings.get_allocator().resource();
+                                              std::string result;
+                                              for (const auto& str : strings)
+                                                  result += str;
+                                              return result;
+                                          }) }
+                                      , sdbus::return_slot );
+
+    auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
+    std::string result;
+    proxy->callMethod("concat").onInterface(interfaceName).withArguments(std::vector<std::string>{"sdbus", "-", "c++"}).storeResultsTo(result);
+
+    ASSERT_THAT(result, Eq("sdbus-c++"));
+    ASSERT_TRUE(argumentsInArena);
+}
+
+TYPED_TEST(SdbusTestObject, DoesNotUseHandlerArenaForPmrArgumentsTakenByNonConstReference)
+{
+    auto& object = this->m_adaptor->getObject();
+    sdbus::InterfaceName const interfaceName{"org.sdbuscpp.integrationtests2"};
+    std::optional<std::pmr::vector<std::pmr::string>> kept;
+    auto vtableSlot = object.addVTable( interfaceName
+                                      , { sdbus::registerMethod("keep").implementedAs([&](std::pmr::vector<std::pmr::string>& strings)
+                                          {
+                                              kept.emplace(std::move(strings)); // Move construction takes the allocator along
+                                          }) }
+                                      , sdbus::return_slot );
+
+    auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
+    proxy->callMethod("keep").onInterface(interfaceName).withArguments(std::vector<std::string>{"sdbus", "-", "c++"});
+
+    ASSERT_TRUE(kept.has_value());
+    ASSERT_THAT(kept->get_allocator().resource(), Eq(std::pmr::get_default_resource()));
+    ASSERT_THAT(*kept, ElementsAre("sdbus", "-", "c++"));
+}
+
+TYPED_TEST(SdbusTestObject, MovesPmrArgumentsIntoRvalueReferenceParametersOfMethodHandler)
+{
+    auto& object = this->m_adaptor->getObject();
+    sdbus::InterfaceName const interfaceName{"org.sdbuscpp.integrationtests2"};
+    std::optional<std::pmr::vector<std::pmr::string>> kept;
+    auto vtableSlot = object.addVTable( interfaceName
+                                      , { sdbus::registerMethod("keep").implementedAs([&](std::pmr::vector<std::pmr::string>&& strings)
+                                          {
+                                              kept.emplace(std::move(strings));
+                                          }) }
+                                      , sdbus::return_slot );
+
+    auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
+    proxy->callMethod("keep").onInterface(interfaceName).withArguments(std::vector<std::string>{"sdbus", "-", "c++"});
+
+    ASSERT_TRUE(kept.has_value());
+    ASSERT_THAT(kept->get_allocator().resource(), Eq(std::pmr::get_default_resource()));
+    ASSERT_THAT(*kept, ElementsAre("sdbus", "-", "c++"));
+}
+
+TYPED_TEST(SdbusTestObject, MovesDeserializedArgumentsIntoByValueParametersOfMethodHandler)
+{
+    using Numbers = std::vector<int32_t, CountingAllocator<int32_t>>;
+    auto& object = this->m_adaptor->getObject();
+    sdbus::InterfaceName const interfaceName{"org.sdbuscpp.integrationtests2"};
+    Numbers stored;
+    std::size_t allocationsUntilStored{};
+    auto vtableSlot = object.addVTable( interfaceName
+                                      , { sdbus::registerMethod("store").implementedAs([&](Numbers numbers)
+                                          {
+                                              stored = std::move(numbers);
+                                              allocationsUntilStored = allocationCount;
+                                          }) }
+                                      , sdbus::return_slot );
+
+    auto proxy = sdbus::createLightWeightProxy(SERVICE_NAME, OBJECT_PATH);
+    allocationCount = 0;
+    proxy->callMethod("store").onInterface(interfaceName).withArguments(std::vector<int32_t>(1000, 42));
+
+    ASSERT_THAT(stored.size(), Eq(1000));
+    ASSERT_THAT(allocationsUntilStored, Eq(1)); // Just the deserialization itself, no copy on the way to the handler
+}
+
 TYPED_TEST(SdbusTestObject, CanUnregisterAdditionallyRegisteredVTableAtAnyTime)
 {
     auto& object = this->m_adaptor->getObject();
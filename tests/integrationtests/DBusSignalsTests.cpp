@@ -97,6 +97,23 @@ TYPED_TEST(SdbusTestObject, EmitsSignalWithLargeMapSuccessfully)
     ASSERT_THAT(this->m_proxy->m_mapFromSignal[1], Eq("This is string nr. 2"));
 }
 
+TYPED_TEST(SdbusTestObject, EmitsBatchOfSignalsSuccessfully)
+{
+    std::map<int32_t, std::string> largeMap;
+    for (int32_t i = 0; i < 20'000; ++i)
+        largeMap.emplace(i, "This is string nr. " + std::to_string(i+1));
+
+    {
+        auto batch = this->s_adaptorConnection->startBatch();
+        this->m_adaptor->emitSimpleSignal();
+        this->m_adaptor->emitSignalWithMap(largeMap);
+    }
+
+    ASSERT_TRUE(waitUntil(this->m_proxy->m_gotSimpleSignal));
+    ASSERT_TRUE(waitUntil(this->m_proxy->m_gotSignalWithMap));
+    ASSERT_THAT(this->m_proxy->m_mapFromSignal[19'999], Eq("This is string nr. 20000"));
+}
+
 TYPED_TEST(SdbusTestObject, EmitsSignalWithVariantSuccessfully)
 {
     double const val = 3.14;
@@ -171,3 +188,35 @@ TYPED_TEST(SdbusTestObject, ReRegistersSignalHandler)
 
     ASSERT_TRUE(waitUntil(this->m_proxy->m_gotSimpleSignal));
 }
+
+TYPED_TEST(SdbusTestObject, EmitsSignalToDemultiplexedProxiesSuccessfully)
+{
+    auto connection = sdbus::createBusConnection();
+    connection->enableSignalDemultiplexing(MANAGER_PATH);
+    connection->enterEventLoopAsync();
+    auto proxy1 = std::make_unique<TestProxy>(*connection, SERVICE_NAME, OBJECT_PATH);
+    auto proxy2 = std::make_unique<TestProxy>(*connection, SERVICE_NAME, OBJECT_PATH);
+    auto proxy3 = std::make_unique<TestProxy>(*connection, SERVICE_NAME, OBJECT_PATH_2);
+
+    this->m_adaptor->emitSimpleSignal();
+
+    ASSERT_TRUE(waitUntil(proxy1->m_gotSimpleSignal));
+    ASSERT_TRUE(waitUntil(proxy2->m_gotSimpleSignal));
+    ASSERT_FALSE(waitUntil(proxy3->m_gotSimpleSignal, 1s));
+}
+
+TYPED_TEST(SdbusTestObject, UnregistersDemultiplexedSignalHandlerForSomeProxies)
+{
+    auto connection = sdbus::createBusConnection();
+    connection->enableSignalDemultiplexing(MANAGER_PATH);
+    connection->enterEventLoopAsync();
+    auto proxy1 = std::make_unique<TestProxy>(*connection, SERVICE_NAME, OBJECT_PATH);
+    auto proxy2 = std::make_unique<TestProxy>(*connection, SERVICE_NAME, OBJECT_PATH);
+
+    ASSERT_NO_THROW(proxy1->unregisterSimpleSignalHandler());
+
+    this->m_adaptor->emitSimpleSignal();
+
+    ASSERT_TRUE(waitUntil(proxy2->m_gotSimpleSignal));
+    ASSERT_FALSE(waitUntil(proxy1->m_gotSimpleSignal, 1s));
+}
@@ -26,6 +26,7 @@
 
 #include "TestFixture.h"
 #include "TestAdaptor.h"
+#include "TestProxy.h"
 #include "Defs.h"
 #include "integrationtests-adaptor.h"
 #include <sdbus-c++/sdbus-c++.h>
@@ -41,6 +42,7 @@
 #include <string>
 #include <future>
 #include <unistd.h>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -67,6 +69,21 @@ TYPED_TEST(SdbusTestObject, AnswersMachineUuidViaPeerInterface)
     ASSERT_NO_THROW(this->m_proxy->GetMachineId());
 }
 
+TYPED_TEST(SdbusTestObject, ProvidesConnectionStatisticsViaStatisticsInterface)
+{
+    const sdbus::ObjectPath statisticsPath{"/org/sdbuscpp/statistics"};
+    StatisticsTestAdaptor statisticsAdaptor{*this->s_adaptorConnection, statisticsPath};
+    auto proxy = sdbus::createProxy(*this->s_proxyConnection, SERVICE_NAME, statisticsPath);
+    this->m_proxy->Ping(); // Make sure the adaptor connection has processed something
+
+    std::map<std::string, sdbus::Variant> statistics;
+    proxy->callMethod("GetStatistics").onInterface("org.sdbuscpp.Statistics").storeResultsTo(statistics);
+
+    ASSERT_THAT(statistics.at("ProcessedMessages").get<uint64_t>() > 0, Eq(true));
+    ASSERT_THAT(statistics.at("DispatchTimeHistogram").get<std::vector<uint64_t>>().size(), Eq(sdbus::IConnection::Metrics::DISPATCH_TIME_HISTOGRAM_SIZE));
+    ASSERT_THAT(statistics.count("PendingAsyncCalls"), Eq(1));
+}
+
 // TODO: Adjust expected xml and uncomment this test
 //TYPED_TEST(SdbusTestObject, AnswersXmlApiDescriptionViaIntrospectableInterface)
 //{
@@ -243,6 +260,114 @@ TYPED_TEST(SdbusTestObject, EmitsPropertyChangedSignalForAllProperties) // NOLIN
     ASSERT_TRUE(waitUntil(signalReceived));
 }
 
+TYPED_TEST(SdbusTestObject, CoalescesPropertiesChangedSignalsWithinInterval)
+{
+    std::atomic<int> signalCount{0};
+    std::map<sdbus::PropertyName, sdbus::Variant> lastChangedProperties;
+    std::vector<sdbus::PropertyName> lastInvalidatedProperties;
+    this->m_proxy->m_onPropertiesChangedHandler = [&]( const sdbus::InterfaceName& /*interfaceName*/
+                                                     , const std::map<sdbus::PropertyName, sdbus::Variant>& changedProperties
+                                                     , const std::vector<sdbus::PropertyName>& invalidatedProperties )
+    {
+        lastChangedProperties = changedProperties;
+        lastInvalidatedProperties = invalidatedProperties;
+        ++signalCount;
+    };
+    this->m_adaptor->coalescePropertiesChangedSignals(INTERFACE_NAME, 100ms);
+
+    this->m_proxy->blocking(!DEFAULT_BLOCKING_VALUE);
+    for (int i = 0; i < 10; ++i)
+        this->m_adaptor->emitPropertiesChangedSignal(INTERFACE_NAME, {BLOCKING_PROPERTY});
+    this->m_adaptor->emitPropertiesChangedSignal(INTERFACE_NAME, {ACTION_PROPERTY});
+
+    ASSERT_TRUE(waitUntil([&](){ return signalCount == 1; }));
+    std::this_thread::sleep_for(200ms);
+    ASSERT_THAT(signalCount, Eq(1));
+    ASSERT_THAT(lastChangedProperties, SizeIs(1));
+    ASSERT_THAT(lastChangedProperties.at(BLOCKING_PROPERTY).template get<bool>(), Eq(!DEFAULT_BLOCKING_VALUE));
+    ASSERT_THAT(lastInvalidatedProperties, Eq(std::vector<sdbus::PropertyName>{ACTION_PROPERTY}));
+}
+
+TYPED_TEST(SdbusTestObject, FlushesCoalescedPropertiesChangedSignalsOnDemand)
+{
+    std::atomic signalReceived{false};
+    this->m_proxy->m_onPropertiesChangedHandler = [&signalReceived]( const sdbus::InterfaceName& /*interfaceName*/
+                                                                   , const std::map<sdbus::PropertyName, sdbus::Variant>& changedProperties
+                                                                   , const std::vector<sdbus::PropertyName>& /*invalidatedProperties*/ )
+    {
+        EXPECT_THAT(changedProperties, SizeIs(1));
+        signalReceived = true;
+    };
+    this->m_adaptor->coalescePropertiesChangedSignals(INTERFACE_NAME, 1h);
+
+    this->m_adaptor->emitPropertiesChangedSignal(INTERFACE_NAME, {BLOCKING_PROPERTY});
+    std::this_thread::sleep_for(50ms);
+    ASSERT_FALSE(signalReceived);
+
+    this->m_adaptor->flushPropertiesChangedSignals();
+
+    ASSERT_TRUE(waitUntil(signalReceived));
+}
+
+TYPED_TEST(SdbusTestObject, ServesPropertiesFromCacheWithoutAskingRemoteObject)
+{
+    CachedPropertiesTestProxy cachedProxy{*this->s_proxyConnection, SERVICE_NAME, OBJECT_PATH};
+    ASSERT_THAT(cachedProxy.getCachedProperty(INTERFACE_NAME, ACTION_PROPERTY).template get<uint32_t>(), Eq(DEFAULT_ACTION_VALUE));
+
+    this->m_proxy->action(DEFAULT_ACTION_VALUE*2); // No PropertiesChanged signal is emitted here
+
+    ASSERT_THAT(cachedProxy.getCachedProperty(INTERFACE_NAME, ACTION_PROPERTY).template get<uint32_t>(), Eq(DEFAULT_ACTION_VALUE));
+    ASSERT_THAT(cachedProxy.getCachedProperties(INTERFACE_NAME)->size(), Eq(4));
+}
+
+TYPED_TEST(SdbusTestObject, UpdatesCachedPropertiesUponPropertiesChangedSignal)
+{
+    CachedPropertiesTestProxy cachedProxy{*this->s_proxyConnection, SERVICE_NAME, OBJECT_PATH};
+    auto snapshot = cachedProxy.getCachedProperties(INTERFACE_NAME);
+
+    this->m_proxy->blocking(!DEFAULT_BLOCKING_VALUE);
+    this->m_adaptor->emitPropertiesChangedSignal(INTERFACE_NAME, {BLOCKING_PROPERTY});
+
+    ASSERT_TRUE(waitUntil([&](){ return cachedProxy.getCachedProperty(INTERFACE_NAME, BLOCKING_PROPERTY).template get<bool>() == !DEFAULT_BLOCKING_VALUE; }));
+    ASSERT_THAT(snapshot->at(BLOCKING_PROPERTY).template get<bool>(), Eq(DEFAULT_BLOCKING_VALUE)); // Snapshots are immutable
+}
+
+TYPED_TEST(SdbusTestObject, RefetchesInvalidatedCachedProperties)
+{
+    CachedPropertiesTestProxy cachedProxy{*this->s_proxyConnection, SERVICE_NAME, OBJECT_PATH};
+    (void)cachedProxy.getCachedProperties(INTERFACE_NAME);
+
+    this->m_proxy->action(DEFAULT_ACTION_VALUE*2);
+    this->m_adaptor->emitPropertiesChangedSignal(INTERFACE_NAME); // The action property gets invalidated
+
+    ASSERT_TRUE(waitUntil([&]()
+    {
+        auto properties = cachedProxy.getCachedProperties(INTERFACE_NAME);
+        auto it = properties->find(ACTION_PROPERTY);
+        return it != properties->end() && it->second.template get<uint32_t>() == DEFAULT_ACTION_VALUE*2;
+    }));
+}
+
+TYPED_TEST(SdbusTestObject, DestroysCachedPropertiesProxyWhileRefetchIsInFlight)
+{
+    for (int i = 0; i < 20; ++i)
+    {
+        auto cachedProxy = std::make_unique<CachedPropertiesTestProxy>(*this->s_proxyConnection, SERVICE_NAME, OBJECT_PATH);
+        (void)cachedProxy->getCachedProperties(INTERFACE_NAME);
+        std::atomic<bool> refetchStarted{false};
+        cachedProxy->m_onCachedPropertiesChangedHandler = [&](const auto&, const auto&, const auto& invalidatedProperties)
+        {
+            if (!invalidatedProperties.empty())
+                refetchStarted = true;
+        };
+
+        this->m_adaptor->emitPropertiesChangedSignal(INTERFACE_NAME); // The action property gets invalidated and re-fetched
+
+        ASSERT_TRUE(waitUntil(refetchStarted));
+        cachedProxy.reset(); // Races with the re-fetch reply being dispatched, and must neither deadlock nor crash
+    }
+}
+
 TYPED_TEST(SdbusTestObject, GetsZeroManagedObjectsIfHasNoSubPathObjects)
 {
     this->m_adaptor.reset();
@@ -302,6 +427,74 @@ TYPED_TEST(SdbusTestObject, GetsManagedObjectsAsynchronouslyViaFutureOverload)
     ASSERT_THAT(future.get().size(), Eq(2));
 }
 
+TYPED_TEST(SdbusTestObject, MirrorsManagedObjectsUponRegistration)
+{
+    auto adaptor2 = std::make_unique<TestAdaptor>(*this->s_adaptorConnection, OBJECT_PATH_2);
+
+    ObjectManagerMirrorTestProxy mirror{*this->s_proxyConnection, SERVICE_NAME, MANAGER_PATH};
+
+    ASSERT_THAT(mirror.getMirroredObjectPaths(), Eq(std::vector<sdbus::ObjectPath>{OBJECT_PATH, OBJECT_PATH_2}));
+    ASSERT_THAT(mirror.getMirroredProperty(OBJECT_PATH_2, INTERFACE_NAME, ACTION_PROPERTY)->template get<uint32_t>(), Eq(DEFAULT_ACTION_VALUE));
+    ASSERT_THAT(mirror.getMirroredProperties(OBJECT_PATH, INTERFACE_NAME), SizeIs(4));
+}
+
+TYPED_TEST(SdbusTestObject, LooksUpMirroredObjectsByPathNamespace)
+{
+    auto adaptor2 = std::make_unique<TestAdaptor>(*this->s_adaptorConnection, OBJECT_PATH_2);
+    ObjectManagerMirrorTestProxy mirror{*this->s_proxyConnection, SERVICE_NAME, MANAGER_PATH};
+
+    ASSERT_THAT(mirror.getMirroredObjectPaths(MANAGER_PATH), SizeIs(2));
+    ASSERT_THAT(mirror.getMirroredObjectPaths(OBJECT_PATH), Eq(std::vector<sdbus::ObjectPath>{OBJECT_PATH}));
+    ASSERT_THAT(mirror.getMirroredObjectPaths("/org/sdbuscpp/integration"), SizeIs(0));
+    ASSERT_THAT(mirror.getMirroredInterfaces(OBJECT_PATH_2).at(OBJECT_PATH_2), testing::Contains(INTERFACE_NAME));
+}
+
+TYPED_TEST(SdbusTestObject, UpdatesMirrorUponInterfacesAddedAndRemovedSignals)
+{
+    ObjectManagerMirrorTestProxy mirror{*this->s_proxyConnection, SERVICE_NAME, MANAGER_PATH};
+    auto adaptor2 = std::make_unique<TestAdaptor>(*this->s_adaptorConnection, OBJECT_PATH_2);
+
+    adaptor2->emitInterfacesAddedSignal({INTERFACE_NAME});
+    ASSERT_TRUE(waitUntil([&](){ return mirror.getMirroredProperty(OBJECT_PATH_2, INTERFACE_NAME, STATE_PROPERTY).has_value(); }));
+
+    this->m_adaptor->emitInterfacesRemovedSignal();
+    ASSERT_TRUE(waitUntil([&](){ return mirror.getMirroredObjectPaths() == std::vector<sdbus::ObjectPath>{OBJECT_PATH_2}; }));
+}
+
+TYPED_TEST(SdbusTestObject, UpdatesMirroredPropertiesUponPropertiesChangedSignal)
+{
+    ObjectManagerMirrorTestProxy mirror{*this->s_proxyConnection, SERVICE_NAME, MANAGER_PATH};
+    std::atomic signalReceived{false};
+    mirror.m_onMirroredPropertiesChangedHandler = [&](const sdbus::ObjectPath& objectPath, const sdbus::InterfaceName& interfaceName)
+    {
+        EXPECT_THAT(objectPath, Eq(OBJECT_PATH));
+        EXPECT_THAT(interfaceName, Eq(INTERFACE_NAME));
+        signalReceived = true;
+    };
+
+    this->m_proxy->blocking(!DEFAULT_BLOCKING_VALUE);
+    this->m_adaptor->emitPropertiesChangedSignal(INTERFACE_NAME); // The action property gets invalidated
+
+    ASSERT_TRUE(waitUntil(signalReceived));
+    ASSERT_THAT(mirror.getMirroredProperty(OBJECT_PATH, INTERFACE_NAME, BLOCKING_PROPERTY)->template get<bool>(), Eq(!DEFAULT_BLOCKING_VALUE));
+    ASSERT_FALSE(mirror.getMirroredProperty(OBJECT_PATH, INTERFACE_NAME, ACTION_PROPERTY).has_value());
+}
+
+TYPED_TEST(SdbusTestObject, StopsMirroringPropertiesChangesUponProxyUnregistration)
+{
+    ObjectManagerMirrorTestProxy mirror{*this->s_proxyConnection, SERVICE_NAME, MANAGER_PATH};
+    std::atomic signalReceived{false};
+    mirror.m_onMirroredPropertiesChangedHandler = [&](const sdbus::ObjectPath& /*objectPath*/, const sdbus::InterfaceName& /*interfaceName*/)
+    {
+        signalReceived = true;
+    };
+
+    mirror.unregisterProxy();
+    this->m_adaptor->emitPropertiesChangedSignal(INTERFACE_NAME);
+
+    ASSERT_FALSE(waitUntil(signalReceived, 1s));
+}
+
 TYPED_TEST(SdbusTestObject, EmitsInterfacesAddedSignalForSelectedObjectInterfaces) // NOLINT(readability-function-cognitive-complexity)
 {
     std::atomic signalReceived{false};
@@ -51,6 +51,7 @@ namespace sdbus::test {
 TestAdaptor::TestAdaptor(sdbus::IConnection& connection, sdbus::ObjectPath path) :
     AdaptorInterfaces(connection, std::move(path))
 {
+    m_selfProxy = sdbus::createProxy(connection, SERVICE_NAME, getObject().getObjectPath());
     registerAdaptor();
 }
 
@@ -174,6 +175,20 @@ void TestAdaptor::doOperationAsync(sdbus::Result<uint32_t>&& result, uint32_t pa
     }
 }
 
+sdbus::Task<uint32_t> TestAdaptor::doOperationCoroutine(uint32_t param)
+{
+    // Delegate the work to the asynchronous doOperationAsync method. The event loop
+    // thread is free to process other messages while this coroutine is suspended.
+    if (param == 0)
+        co_await m_selfProxy->callMethodAsync("throwError").onInterface(sdbus::test::INTERFACE_NAME).getResultAsAwaitable<>();
+
+    auto result = co_await m_selfProxy->callMethodAsync("doOperationAsync")
+                                       .onInterface(sdbus::test::INTERFACE_NAME)
+                                       .withArguments(param)
+                                       .getResultAsAwaitable<uint32_t>();
+    co_return result;
+}
+
 void TestAdaptor::doOperationAsyncWithLargeData(sdbus::Result<std::map<int32_t, std::string>>&& result, uint32_t param, const std::map<int32_t, std::string>& largeMap)
 {
     m_methodCallMsg = std::make_unique<const Message>(getObject().getCurrentlyProcessedMessage());
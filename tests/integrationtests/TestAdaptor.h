@@ -57,6 +57,26 @@ public:
     }
 };
 
+class StatisticsTestAdaptor final : public sdbus::AdaptorInterfaces< sdbus::Statistics_adaptor >
+{
+public:
+    StatisticsTestAdaptor(sdbus::IConnection& connection, sdbus::ObjectPath path) :
+        AdaptorInterfaces(connection, std::move(path))
+    {
+        registerAdaptor();
+    }
+
+    StatisticsTestAdaptor(const StatisticsTestAdaptor&) = delete;
+    StatisticsTestAdaptor& operator=(const StatisticsTestAdaptor&) = delete;
+    StatisticsTestAdaptor(StatisticsTestAdaptor&&) = delete;
+    StatisticsTestAdaptor& operator=(StatisticsTestAdaptor&&) = delete;
+
+    ~StatisticsTestAdaptor()
+    {
+        unregisterAdaptor();
+    }
+};
+
 class TestAdaptor final : public sdbus::AdaptorInterfaces< org::sdbuscpp::integrationtests_adaptor
                                                          , sdbus::Properties_adaptor
                                                          , sdbus::ManagedObject_adaptor >
@@ -84,6 +104,7 @@ protected:
     uint32_t doOperation(const uint32_t& param) override;
     std::map<int32_t, std::string> doOperationWithLargeData(const std::map<int32_t, std::string>& largeParam) override;
     void doOperationAsync(sdbus::Result<uint32_t>&& result, uint32_t param) override;
+    sdbus::Task<uint32_t> doOperationCoroutine(uint32_t param) override;
     void doOperationAsyncWithLargeData(sdbus::Result<std::map<int32_t, std::string>>&& result, uint32_t param, const std::map<int32_t, std::string>& largeMap) override;
     sdbus::Signature getSignature() override;
     sdbus::ObjectPath getObjPath() override;
@@ -114,6 +135,8 @@ private:
     uint32_t m_action{DEFAULT_ACTION_VALUE};
     bool m_blocking{DEFAULT_BLOCKING_VALUE};
     sdbus::Variant m_actionVariant{"ahoj"};
+    // Calls back into this very object, so that coroutine handlers have something to co_await
+    std::unique_ptr<sdbus::IProxy> m_selfProxy;
 
 public: // for tests
     // For dont-expect-reply method call verifications
@@ -151,6 +174,7 @@ protected:
     uint32_t doOperation(const uint32_t&) override { return {}; }
     std::map<int32_t, std::string> doOperationWithLargeData(const std::map<int32_t, std::string>&) override { return {}; }
     void doOperationAsync(sdbus::Result<uint32_t>&&, uint32_t) override {}
+    sdbus::Task<uint32_t> doOperationCoroutine(uint32_t) override { co_return {}; }
     void doOperationAsyncWithLargeData(sdbus::Result<std::map<int32_t, std::string>>&&, uint32_t, const std::map<int32_t, std::string>&) override {}
     sdbus::Signature getSignature() override { return {}; }
     sdbus::ObjectPath getObjPath() override { return {}; }
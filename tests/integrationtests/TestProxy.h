@@ -73,6 +73,71 @@ public: // for tests
     std::function<void(const sdbus::ObjectPath&, const std::vector<sdbus::InterfaceName>&)> m_onInterfacesRemovedHandler;
 };
 
+class CachedPropertiesTestProxy final : public sdbus::ProxyInterfaces< sdbus::CachedProperties_proxy >
+{
+public:
+    CachedPropertiesTestProxy(sdbus::IConnection& connection, ServiceName destination, ObjectPath objectPath)
+        : ProxyInterfaces(connection, std::move(destination), std::move(objectPath))
+    {
+        registerProxy();
+    }
+
+    CachedPropertiesTestProxy(const CachedPropertiesTestProxy&) = delete;
+    CachedPropertiesTestProxy& operator=(const CachedPropertiesTestProxy&) = delete;
+    CachedPropertiesTestProxy(CachedPropertiesTestProxy&&) = delete;
+    CachedPropertiesTestProxy& operator=(CachedPropertiesTestProxy&&) = delete;
+
+    ~CachedPropertiesTestProxy()
+    {
+        unregisterProxy();
+    }
+
+protected:
+    void onCachedPropertiesChanged( const sdbus::InterfaceName& interfaceName
+                                  , const std::map<PropertyName, sdbus::Variant>& changedProperties
+                                  , const std::vector<PropertyName>& invalidatedProperties ) override
+    {
+        if (m_onCachedPropertiesChangedHandler)
+            m_onCachedPropertiesChangedHandler(interfaceName, changedProperties, invalidatedProperties);
+    }
+
+public: // for tests
+    std::function<void(const sdbus::InterfaceName&, const std::map<PropertyName, sdbus::Variant>&, const std::vector<PropertyName>&)> m_onCachedPropertiesChangedHandler;
+};
+
+class ObjectManagerMirrorTestProxy final : public sdbus::ProxyInterfaces< sdbus::ObjectManagerMirror_proxy >
+{
+public:
+    ObjectManagerMirrorTestProxy(sdbus::IConnection& connection, ServiceName destination, ObjectPath objectPath)
+        : ProxyInterfaces(connection, std::move(destination), std::move(objectPath))
+    {
+        registerProxy();
+    }
+
+    ObjectManagerMirrorTestProxy(const ObjectManagerMirrorTestProxy&) = delete;
+    ObjectManagerMirrorTestProxy& operator=(const ObjectManagerMirrorTestProxy&) = delete;
+    ObjectManagerMirrorTestProxy(ObjectManagerMirrorTestProxy&&) = delete;
+    ObjectManagerMirrorTestProxy& operator=(ObjectManagerMirrorTestProxy&&) = delete;
+
+    ~ObjectManagerMirrorTestProxy()
+    {
+        unregisterProxy();
+    }
+
+protected:
+    void onMirroredPropertiesChanged( const sdbus::ObjectPath& objectPath
+                                    , const sdbus::InterfaceName& interfaceName
+                                    , const std::map<PropertyName, sdbus::Variant>& /*changedProperties*/
+                                    , const std::vector<PropertyName>& /*invalidatedProperties*/ ) override
+    {
+        if (m_onMirroredPropertiesChangedHandler)
+            m_onMirroredPropertiesChangedHandler(objectPath, interfaceName);
+    }
+
+public: // for tests
+    std::function<void(const sdbus::ObjectPath&, const sdbus::InterfaceName&)> m_onMirroredPropertiesChangedHandler;
+};
+
 class TestProxy final : public sdbus::ProxyInterfaces< org::sdbuscpp::integrationtests_proxy
                                                      , sdbus::Peer_proxy
                                                      , sdbus::Introspectable_proxy
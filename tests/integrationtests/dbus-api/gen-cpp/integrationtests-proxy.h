@@ -144,6 +144,13 @@ public:
         return result;
     }
 
+    uint32_t doOperationCoroutine(const uint32_t& arg0)
+    {
+        uint32_t result;
+        m_proxy.callMethod("doOperationCoroutine").onInterface(INTERFACE_NAME).withArguments(arg0).storeResultsTo(result);
+        return result;
+    }
+
     std::map<int32_t, std::string> doOperationAsyncWithLargeData(const uint32_t& arg0, const std::map<int32_t, std::string>& largeParam)
     {
         std::map<int32_t, std::string> result;
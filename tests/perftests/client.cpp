@@ -37,6 +37,12 @@
 #include <chrono>
 #include <cassert>
 #include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -84,10 +90,131 @@ protected:
     }
 
 public:
+    // Keeps `callsInFlight' async method calls pending at any time: each reply issues a new call,
+    // until `callCount' calls have completed. Returns the time it took to complete all calls.
+    std::chrono::milliseconds callConcatenateTwoStringsAsync(const std::string& string1, const std::string& string2, unsigned int callCount, unsigned int callsInFlight)
+    {
+        std::mutex mutex;
+        std::condition_variable cond;
+        unsigned int issuedCalls{};
+        unsigned int completedCalls{};
+
+        std::function<void()> issueCall = [&]()
+        {
+            getProxy().callMethodAsync("concatenateTwoStrings").onInterface(INTERFACE_NAME).withArguments(string1, string2).uponReplyInvoke([&](std::optional<sdbus::Error> error, const std::string& result)
+            {
+                assert(!error.has_value());
+                assert(result.size() == string1.size() + string2.size());
+
+                std::unique_lock lock(mutex);
+                if (++completedCalls == callCount)
+                    cond.notify_one();
+                if (issuedCalls == callCount)
+                    return;
+                ++issuedCalls;
+                lock.unlock();
+                issueCall();
+            });
+        };
+
+        auto startTime = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < std::min(callsInFlight, callCount); ++i)
+        {
+            {
+                const std::lock_guard lock(mutex);
+                ++issuedCalls;
+            }
+            issueCall();
+        }
+        std::unique_lock lock(mutex);
+        cond.wait(lock, [&](){ return completedCalls == callCount; });
+        auto stopTime = std::chrono::steady_clock::now();
+
+        return std::chrono::duration_cast<std::chrono::milliseconds>(stopTime - startTime);
+    }
+
+    // Issues `callCount' async method calls in bursts of `burstSize' calls, each burst optionally within a connection
+    // batch, and waits for all replies of a burst before issuing the next one. Returns the achieved calls per second.
+    uint64_t callConcatenateTwoStringsInBursts(const std::string& string1, const std::string& string2, unsigned int callCount, unsigned int burstSize, bool batched)
+    {
+        std::vector<std::future<std::string>> futures;
+        futures.reserve(burstSize);
+
+        auto startTime = std::chrono::steady_clock::now();
+        for (unsigned int issuedCalls = 0; issuedCalls < callCount; issuedCalls += burstSize)
+        {
+            {
+                sdbus::Slot batch;
+                if (batched)
+                    batch = getProxy().getConnection().startBatch();
+                for (unsigned int i = 0; i < burstSize; ++i)
+                    futures.push_back(getProxy().callMethodAsync("concatenateTwoStrings").onInterface(INTERFACE_NAME).withArguments(string1, string2).getResultAsFuture<std::string>());
+            }
+
+            for (auto& future : futures)
+            {
+                [[maybe_unused]] auto result = future.get();
+                assert(result.size() == string1.size() + string2.size());
+            }
+            futures.clear();
+        }
+        auto stopTime = std::chrono::steady_clock::now();
+
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(stopTime - startTime).count();
+        return duration > 0 ? callCount * 1'000'000ULL / static_cast<uint64_t>(duration) : 0;
+    }
+
     unsigned int m_msgSize{};
     unsigned int m_msgCount{};
 };
 
+// Calls methods of an interface with `methodCount' methods in a round-robin fashion. Returns the achieved calls per second.
+uint64_t callManyMethods(unsigned int methodCount, unsigned int callCount)
+{
+    auto proxy = sdbus::createProxy(sdbus::ServiceName{"org.sdbuscpp.perftests"}, sdbus::ObjectPath{"/org/sdbuscpp/perftests/manymethods"});
+    const sdbus::InterfaceName interfaceName{"org.sdbuscpp.perftests.ManyMethods"};
+
+    std::vector<sdbus::MethodName> methodNames;
+    methodNames.reserve(methodCount);
+    for (unsigned int i = 0; i < methodCount; ++i)
+        methodNames.emplace_back("method" + std::to_string(i));
+
+    auto startTime = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < callCount; ++i)
+    {
+        uint32_t result{};
+        proxy->callMethod(methodNames[i % methodCount]).onInterface(interfaceName).withArguments(i).storeResultsTo(result);
+        assert(result == i);
+    }
+    auto stopTime = std::chrono::steady_clock::now();
+
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(stopTime - startTime).count();
+    return duration > 0 ? callCount * 1'000'000ULL / static_cast<uint64_t>(duration) : 0;
+}
+
+// Creates `proxyCount' proxies for distinct objects, each with a signal handler, on a fresh connection.
+// Returns the time it took, which is dominated by match rule registration round trips to the bus daemon.
+std::chrono::milliseconds createManyProxies(unsigned int proxyCount, bool demultiplexSignals)
+{
+    auto connection = sdbus::createBusConnection();
+    if (demultiplexSignals)
+        connection->enableSignalDemultiplexing(sdbus::ObjectPath{"/org/sdbuscpp/perftests"});
+
+    std::vector<std::unique_ptr<sdbus::IProxy>> proxies;
+    proxies.reserve(proxyCount);
+
+    auto startTime = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < proxyCount; ++i)
+    {
+        auto proxy = sdbus::createProxy(*connection, sdbus::ServiceName{"org.sdbuscpp.perftests"}, sdbus::ObjectPath{"/org/sdbuscpp/perftests/device" + std::to_string(i)});
+        proxy->uponSignal("dataSignal").onInterface(org::sdbuscpp::perftests_proxy::INTERFACE_NAME).call([](const std::string& /*data*/){});
+        proxies.push_back(std::move(proxy));
+    }
+    auto stopTime = std::chrono::steady_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::milliseconds>(stopTime - startTime);
+}
+
 std::string createRandomString(size_t length)
 {
     auto randchar = []() -> char
@@ -199,5 +326,77 @@ int main(int /*argc*/, char */*argv*/[])
     std::cout << "AVERAGE: " << (totalDuration/repetitions) << " ms" << '\n';
     totalDuration = 0;
 
+    msgSize = 20;
+    const unsigned int asyncCallCount = 20000;
+    // The system bus daemon limits the number of pending replies per connection (128 by default)
+    for (unsigned int callsInFlight : {1U, 10U, 100U})
+    {
+        std::cout << '\n' << "** Measuring async method calls with " << callsInFlight << " calls in flight (" << repetitions << " repetitions)..." << '\n' << '\n';
+        for (unsigned int i = 0; i < repetitions; ++i)
+        {
+            auto str1 = createRandomString(msgSize/2);
+            auto str2 = createRandomString(msgSize/2);
+
+            auto duration = client.callConcatenateTwoStringsAsync(str1, str2, asyncCallCount, callsInFlight).count();
+            totalDuration += duration;
+            std::cout << "Completed " << asyncCallCount << " async methods in: " << duration << " ms ("
+                      << (duration > 0 ? asyncCallCount * 1000ULL / static_cast<uint64_t>(duration) : 0) << " calls/s)" << '\n';
+
+            std::this_thread::sleep_for(1000ms);
+        }
+
+        std::cout << "AVERAGE: " << (totalDuration/repetitions) << " ms" << '\n';
+        totalDuration = 0;
+    }
+
+    // Bursts stay below the limit of pending replies per connection imposed by the system bus daemon
+    const unsigned int burstSize = 100;
+    for (bool batched : {false, true})
+    {
+        std::cout << '\n' << "** Measuring bursts of " << burstSize << " async method calls " << (batched ? "with" : "without")
+                  << " batching (" << repetitions << " repetitions)..." << '\n' << '\n';
+        uint64_t totalRate = 0;
+        for (unsigned int i = 0; i < repetitions; ++i)
+        {
+            auto str1 = createRandomString(msgSize/2);
+            auto str2 = createRandomString(msgSize/2);
+
+            auto rate = client.callConcatenateTwoStringsInBursts(str1, str2, asyncCallCount, burstSize, batched);
+            totalRate += rate;
+            std::cout << "Completed " << asyncCallCount << " async methods at " << rate << " calls/s" << '\n';
+        }
+
+        std::cout << "AVERAGE: " << (totalRate/repetitions) << " calls/s" << '\n';
+    }
+
+    // The system bus daemon limits the number of match rules per connection (512 by default)
+    const unsigned int proxyCount = 500;
+    for (bool demultiplexSignals : {false, true})
+    {
+        std::cout << '\n' << "** Measuring creation of " << proxyCount << " proxies with signal handlers " << (demultiplexSignals ? "with" : "without")
+                  << " signal demultiplexing (" << repetitions << " repetitions)..." << '\n' << '\n';
+        for (unsigned int i = 0; i < repetitions; ++i)
+        {
+            auto duration = createManyProxies(proxyCount, demultiplexSignals).count();
+            totalDuration += duration;
+            std::cout << "Created " << proxyCount << " proxies in: " << duration << " ms" << '\n';
+        }
+
+        std::cout << "AVERAGE: " << (totalDuration/repetitions) << " ms" << '\n';
+        totalDuration = 0;
+    }
+
+    const unsigned int methodCount = 500;
+    std::cout << '\n' << "** Measuring method calls on an interface with " << methodCount << " methods (" << repetitions << " repetitions)..." << '\n' << '\n';
+    uint64_t totalRate = 0;
+    for (unsigned int i = 0; i < repetitions; ++i)
+    {
+        auto rate = callManyMethods(methodCount, msgCount);
+        totalRate += rate;
+        std::cout << "Called " << msgCount << " methods at " << rate << " calls/s" << '\n';
+    }
+
+    std::cout << "AVERAGE: " << (totalRate/repetitions) << " calls/s" << '\n';
+
     return 0;
 }
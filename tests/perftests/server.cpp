@@ -35,6 +35,8 @@
 #include <chrono>
 #include <algorithm>
 #include <iostream>
+#include <memory>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -80,6 +82,21 @@ protected:
     }
 };
 
+// An object with an interface of many methods, which measures the cost of looking a method up on dispatch
+std::unique_ptr<sdbus::IObject> createManyMethodsObject(sdbus::IConnection& connection, unsigned int methodCount)
+{
+    auto object = sdbus::createObject(connection, sdbus::ObjectPath{"/org/sdbuscpp/perftests/manymethods"});
+
+    std::vector<sdbus::VTableItem> vtable;
+    vtable.reserve(methodCount);
+    for (unsigned int i = 0; i < methodCount; ++i)
+        vtable.push_back(sdbus::registerMethod(sdbus::MethodName{"method" + std::to_string(i)}).implementedAs([](const uint32_t& param){ return param; }));
+
+    object->addVTable(sdbus::InterfaceName{"org.sdbuscpp.perftests.ManyMethods"}, std::move(vtable));
+
+    return object;
+}
+
 std::string createRandomString(size_t length)
 {
     auto randchar = []() -> char
@@ -110,6 +127,7 @@ int main(int /*argc*/, char */*argv*/[])
 
     sdbus::ObjectPath objectPath{"/org/sdbuscpp/perftests"};
     PerftestAdaptor server(*connection, std::move(objectPath)); // NOLINT(misc-const-correctness)
+    auto manyMethodsServer = createManyMethodsObject(*connection, 500);
 
     connection->enterEventLoop();
 }
@@ -0,0 +1,135 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file variants.cpp
+ *
+ * Created on: Oct 15, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sdbus-c++/sdbus-c++.h>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Measures the cost of decoding `a{sv}' dictionaries (as returned by Properties.GetAll or
+// ObjectManager.GetManagedObjects) into std::map<PropertyName, Variant>, and the cost of
+// extracting the values from the variants. No bus is needed; the dictionary is decoded from
+// a local plain message. Run against different builds of sdbus-c++ to compare them.
+
+namespace {
+
+using Properties = std::map<sdbus::PropertyName, sdbus::Variant>;
+
+// A property set resembling a typical service object: mostly basic types, a few containers
+Properties createProperties()
+{
+    Properties properties;
+    for (int i = 0; i < 4; ++i)
+    {
+        auto suffix = std::to_string(i);
+        properties[sdbus::PropertyName{"Enabled" + suffix}] = sdbus::Variant{i % 2 == 0};
+        properties[sdbus::PropertyName{"Count" + suffix}] = sdbus::Variant{static_cast<uint32_t>(i * 1000)};
+        properties[sdbus::PropertyName{"Offset" + suffix}] = sdbus::Variant{static_cast<int64_t>(-i)};
+        properties[sdbus::PropertyName{"Ratio" + suffix}] = sdbus::Variant{i * 0.5};
+        properties[sdbus::PropertyName{"Name" + suffix}] = sdbus::Variant{std::string{"org.sdbuscpp.perftests.name"} + suffix};
+        properties[sdbus::PropertyName{"Path" + suffix}] = sdbus::Variant{sdbus::ObjectPath{"/org/sdbuscpp/perftests/" + suffix}};
+    }
+    properties[sdbus::PropertyName{"Tags"}] = sdbus::Variant{std::vector<std::string>{"alpha", "beta", "gamma"}};
+    properties[sdbus::PropertyName{"Limits"}] = sdbus::Variant{sdbus::Struct<uint32_t, uint32_t>{10, 20}};
+    return properties;
+}
+
+template <typename Function>
+void measure(const std::string& name, unsigned int iterations, Function&& function)
+{
+    auto startTime = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; ++i)
+        function();
+    auto stopTime = std::chrono::steady_clock::now();
+
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(stopTime - startTime).count();
+    std::cout << name << ": " << duration / iterations << " ns per dictionary" << '\n';
+}
+
+} // namespace
+
+//-----------------------------------------
+int main(int argc, char *argv[]) // NOLINT(bugprone-exception-escape)
+{
+    unsigned int iterations{100000};
+
+    if (argc == 2)
+        iterations = static_cast<unsigned int>(std::atol(argv[1])); // NOLINT(cert-err34-c, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    else if (argc != 1)
+        throw std::runtime_error("Wrong program options");
+
+    auto properties = createProperties();
+    auto msg = sdbus::createPlainMessage();
+    msg << properties;
+    msg.seal();
+
+    std::cout << "** Measuring decoding of a{sv} with " << properties.size() << " entries (" << iterations << " iterations)..." << '\n' << '\n';
+
+    measure("Decode", iterations, [&]()
+    {
+        Properties result;
+        msg.rewind(true);
+        msg >> result;
+        if (result.size() != properties.size())
+            throw std::runtime_error("Unexpected dictionary size");
+    });
+
+    uint64_t checksum{};
+    measure("Decode and extract values", iterations, [&]()
+    {
+        Properties result;
+        msg.rewind(true);
+        msg >> result;
+        for (int i = 0; i < 4; ++i)
+        {
+            auto suffix = std::to_string(i);
+            checksum += result[sdbus::PropertyName{"Enabled" + suffix}].get<bool>() ? 1 : 0;
+            checksum += result[sdbus::PropertyName{"Count" + suffix}].get<uint32_t>();
+            checksum += static_cast<uint64_t>(result[sdbus::PropertyName{"Offset" + suffix}].get<int64_t>());
+            checksum += static_cast<uint64_t>(result[sdbus::PropertyName{"Ratio" + suffix}].get<double>());
+            checksum += result[sdbus::PropertyName{"Name" + suffix}].get<std::string>().size();
+            checksum += result[sdbus::PropertyName{"Path" + suffix}].get<sdbus::ObjectPath>().size();
+        }
+        checksum += result[sdbus::PropertyName{"Tags"}].get<std::vector<std::string>>().size();
+        checksum += std::get<0>(result[sdbus::PropertyName{"Limits"}].get<sdbus::Struct<uint32_t, uint32_t>>());
+    });
+
+    measure("Copy decoded dictionary", iterations, [&]()
+    {
+        auto copy = properties;
+        if (copy.size() != properties.size())
+            throw std::runtime_error("Unexpected dictionary size");
+    });
+
+    std::cout << '\n' << "Checksum: " << checksum << '\n';
+
+    return 0;
+}
@@ -0,0 +1,163 @@
+/**
+ * (C) 2016 - 2021 KISTLER INSTRUMENTE AG, Winterthur, Switzerland
+ * (C) 2016 - 2026 Stanislav Angelovic <stanislav.angelovic@protonmail.com>
+ *
+ * @file sdbus-c++-lock-scaling-tests.cpp
+ *
+ * Created on: Oct 15, 2026
+ * Project: sdbus-c++
+ * Description: High-level D-Bus IPC C++ library based on sd-bus
+ *
+ * This file is part of sdbus-c++.
+ *
+ * sdbus-c++ is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 2.1 of the License, or
+ * (at your option) any later version.
+ *
+ * sdbus-c++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sdbus-c++/sdbus-c++.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Measures how throughput of message-local operations scales with the number of worker threads.
+// Neither of the scenarios sends anything over the bus, so ideally the throughput grows linearly
+// with the number of threads, up to the number of cores. Any sub-linear scaling points to lock
+// contention in sdbus-c++ (or sd-bus) on the way.
+
+using namespace std::chrono_literals;
+
+namespace {
+
+using Scenario = std::function<void(uint64_t& iterations, const std::atomic<bool>& stop)>;
+
+// Variants of basic types and strings are stored inline, so container-typed values are used here.
+// Those are backed by plain messages created from sdbus-c++ internal pseudo connections, so
+// construction, copying and destruction of the variants involve message creation and ref/unref.
+void variantChurn(uint64_t& iterations, const std::atomic<bool>& stop)
+{
+    const std::vector<int32_t> numbers{1, 2, 3, 4, 5, 6, 7, 8};
+    while (!stop)
+    {
+        std::map<std::string, sdbus::Variant> dict;
+        dict["key1"] = sdbus::Variant{numbers};
+        dict["key2"] = sdbus::Variant{sdbus::Struct<std::string, uint32_t>{"sdbus-c++-lock-scaling-tests", static_cast<uint32_t>(iterations)}};
+        auto copy = dict;
+        if (std::get<1>(copy.at("key2").get<sdbus::Struct<std::string, uint32_t>>()) != static_cast<uint32_t>(iterations))
+            throw std::runtime_error("Unexpected variant content");
+        ++iterations;
+    }
+}
+
+// All worker threads share a single bus connection here. Signal creation locks the bus,
+// but serialization of the (fairly large) message payload shall proceed without the lock.
+Scenario signalBuilding(sdbus::IObject& object)
+{
+    return [&object](uint64_t& iterations, const std::atomic<bool>& stop)
+    {
+        const std::vector<int32_t> payload(16 * 1024, 42);
+        while (!stop)
+        {
+            auto signal = object.createSignal(sdbus::InterfaceName{"org.sdbuscpp.stresstests.lockscaling"}, sdbus::SignalName{"dataSignal"});
+            signal << payload << std::string{"sdbus-c++-lock-scaling-tests"};
+            signal.seal();
+            ++iterations;
+        }
+    };
+}
+
+double measure(const Scenario& scenario, unsigned int threadCount, std::chrono::milliseconds duration)
+{
+    std::atomic<bool> stop{false};
+    std::vector<uint64_t> iterations(threadCount);
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+
+    for (unsigned int i = 0; i < threadCount; ++i)
+    {
+        // Counted on the thread's own stack and stored once at the end, as adjacent counters in the vector
+        // would share cache lines, and the false sharing would skew the measured scaling
+        threads.emplace_back([&, i]()
+        {
+            uint64_t localIterations{};
+            scenario(localIterations, stop);
+            iterations[i] = localIterations;
+        });
+    }
+
+    std::this_thread::sleep_for(duration);
+    stop = true;
+    for (auto& thread : threads)
+        thread.join();
+
+    uint64_t total{};
+    for (auto count : iterations)
+        total += count;
+
+    return static_cast<double>(total) * 1000. / static_cast<double>(duration.count());
+}
+
+void runScenario(const std::string& name, const Scenario& scenario, unsigned int maxThreads, std::chrono::milliseconds duration)
+{
+    std::cout << "** Measuring " << name << " (" << duration.count() << " ms per step)...\n\n";
+
+    double singleThreadRate{};
+    for (unsigned int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        auto rate = measure(scenario, threads, duration);
+        if (threads == 1)
+            singleThreadRate = rate;
+
+        std::cout << threads << " thread(s): " << static_cast<uint64_t>(rate) << " ops/s"
+                  << ", speedup " << (singleThreadRate > 0 ? rate / singleThreadRate : 0.) << "x\n";
+    }
+
+    std::cout << '\n';
+}
+
+} // namespace
+
+//-----------------------------------------
+int main(int argc, char *argv[]) // NOLINT(bugprone-exception-escape)
+{
+    unsigned int maxThreads = std::thread::hardware_concurrency();
+    long stepDuration{1000};
+
+    if (argc == 3)
+    {
+        maxThreads = static_cast<unsigned int>(std::atol(argv[1])); // NOLINT(cert-err34-c, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        stepDuration = std::atol(argv[2]); // NOLINT(cert-err34-c, cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+    else if (argc != 1)
+        throw std::runtime_error("Wrong program options");
+
+    if (maxThreads == 0)
+        maxThreads = 1;
+
+    const std::chrono::milliseconds duration{stepDuration};
+
+    runScenario("variant construction, copy and destruction", variantChurn, maxThreads, duration);
+
+    auto connection = sdbus::createBusConnection();
+    auto object = sdbus::createObject(*connection, sdbus::ObjectPath{"/org/sdbuscpp/stresstests/lockscaling"});
+    runScenario("signal creation and serialization on a shared connection", signalBuilding(*object), maxThreads, duration);
+
+    return 0;
+}
@@ -31,8 +31,14 @@
 #include "mocks/SdBusMock.h"
 
 #include <gtest/gtest.h> // IWYU pragma: export
+#include <gmock/gmock.h>
+#include <atomic>
 #include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <future>
 #include <memory>
+#include <thread>
 #include <utility>
 
 // NOLINTBEGIN(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
@@ -42,6 +48,7 @@ using ::testing::DoAll;
 using ::testing::SetArgPointee;
 using ::testing::Return;
 using ::testing::NiceMock;
+using ::testing::HasSubstr;
 using ::sdbus::internal::Connection;
 
 class ConnectionCreationTest : public ::testing::Test
@@ -228,4 +235,65 @@ TYPED_TEST(AConnectionNameRequest, ThrowsOnFail)
     ASSERT_THROW(this->con_->requestName(name), sdbus::Error);
 }
 
+TEST_F(ADefaultBusConnection, ReportsQueueSizesAndProcessedMessagesInMetrics)
+{
+    ON_CALL(*sdBusIntfMock_, sd_bus_open(_)).WillByDefault(DoAll(SetArgPointee<0>(fakeBusPtr_), Return(1)));
+    EXPECT_CALL(*sdBusIntfMock_, sd_bus_process(_, _)).WillOnce(Return(1)).WillOnce(Return(1)).WillOnce(Return(0));
+    EXPECT_CALL(*sdBusIntfMock_, sd_bus_get_n_queued(_, _, _)).WillOnce(DoAll(SetArgPointee<1>(3), SetArgPointee<2>(5), Return(0)));
+    Connection connection(std::move(sdBusIntfMock_), Connection::default_bus);
+
+    while (connection.processPendingEvent())
+        ;
+    auto metrics = connection.getMetrics();
+
+    ASSERT_EQ(metrics.readQueueSize, 3);
+    ASSERT_EQ(metrics.writeQueueSize, 5);
+    ASSERT_EQ(metrics.processedMessages, 2);
+}
+
+TEST_F(ADefaultBusConnection, DoesNotQueryDefaultMethodCallTimeoutForSyncCallsServedByEventLoop)
+{
+    ON_CALL(*sdBusIntfMock_, sd_bus_open(_)).WillByDefault(DoAll(SetArgPointee<0>(fakeBusPtr_), Return(1)));
+    // Like libsystemd < 240, which can't report the default method call timeout
+    ON_CALL(*sdBusIntfMock_, sd_bus_get_method_call_timeout(_, _)).WillByDefault(Return(-EOPNOTSUPP));
+    // No bus fd to watch, so the event loop sleeps until woken up or told to exit
+    ON_CALL(*sdBusIntfMock_, sd_bus_get_poll_data(_, _)).WillByDefault(DoAll(SetArgPointee<1>(SdBusMock::PollData{-1, 0, UINT64_MAX}), Return(0)));
+    std::atomic<bool> eventLoopRunning{false};
+    ON_CALL(*sdBusIntfMock_, sd_bus_process(_, _)).WillByDefault([&](sd_bus* /*bus*/, sd_bus_message** /*msg*/){ eventLoopRunning = true; return 0; });
+    std::promise<void> callSent;
+    EXPECT_CALL(*sdBusIntfMock_, sd_bus_call_async(_, _, _, _, _, 0)).WillOnce([&](auto&&...){ callSent.set_value(); return 0; });
+    Connection connection(std::move(sdBusIntfMock_), Connection::default_bus);
+    connection.enterEventLoopAsync();
+    while (!eventLoopRunning)
+        std::this_thread::yield();
+
+    // The reply never comes, so the call only gets completed by the exit of the event loop
+    std::thread leaver([&](){ callSent.get_future().wait(); connection.leaveEventLoop(); });
+    try
+    {
+        (void)connection.callMethod(reinterpret_cast<sd_bus_message*>(1), 0);
+        FAIL() << "Expected sdbus::Error";
+    }
+    catch (const sdbus::Error& e)
+    {
+        EXPECT_THAT(e.getMessage(), HasSubstr("event loop exited"));
+    }
+    leaver.join();
+}
+
+TEST_F(ADefaultBusConnection, DoesNotFireDueTimerWhoseSlotGotReleasedByEarlierTimerCallback)
+{
+    ON_CALL(*sdBusIntfMock_, sd_bus_open(_)).WillByDefault(DoAll(SetArgPointee<0>(fakeBusPtr_), Return(1)));
+    Connection connection(std::move(sdBusIntfMock_), Connection::default_bus);
+    bool secondTimerFired{false};
+    sdbus::Slot secondTimer;
+    auto firstTimer = connection.addTimer(std::chrono::microseconds{0}, [&](){ secondTimer.reset(); });
+    secondTimer = connection.addTimer(std::chrono::microseconds{1}, [&](){ secondTimerFired = true; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(1)); // Both timers are due now, in one batch
+
+    (void)connection.processPendingEvent();
+
+    ASSERT_FALSE(secondTimerFired);
+}
+
 // NOLINTEND(bugprone-reserved-identifier,cert-dcl37-c,cert-dcl51-cpp)
@@ -25,20 +25,27 @@
  */
 
 #include <sdbus-c++/Error.h>
+#include <sdbus-c++/MemfdArray.h>
 #include <sdbus-c++/Message.h>
+#include <sdbus-c++/MessageArena.h>
 #include <sdbus-c++/Types.h>
 #include <sdbus-c++/TypeTraits.h>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <list>
 #include <map>
+#include <memory>
+#include <memory_resource>
 #include <span>
 #include <string>
 #include <string_view>
 #include <variant>
 #include <vector>
+#include <sys/mman.h>
+#include <unistd.h>
 
 using ::testing::Eq;
 using ::testing::StrEq;
@@ -56,6 +63,34 @@ namespace
         msg >> str;
         return str;
     }
+
+    struct AllocationCounter
+    {
+        inline static std::size_t count{};
+    };
+
+    template <typename T>
+    struct CountingAllocator
+    {
+        using value_type = T;
+
+        CountingAllocator() = default;
+        template <typename U>
+        CountingAllocator(const CountingAllocator<U>& /*other*/) noexcept {} // NOLINT(google-explicit-constructor)
+
+        T* allocate(std::size_t n)
+        {
+            ++AllocationCounter::count;
+            return std::allocator<T>{}.allocate(n);
+        }
+
+        void deallocate(T* ptr, std::size_t n) noexcept
+        {
+            std::allocator<T>{}.deallocate(ptr, n);
+        }
+
+        friend bool operator==(const CountingAllocator& /*lhs*/, const CountingAllocator& /*rhs*/) { return true; }
+    };
 } // namespace
 
 namespace sdbus {
@@ -247,6 +282,36 @@ TEST(AMessage, CanCarryAStringAsAStringView)
     ASSERT_THAT(dataRead, Eq(dataWritten));
 }
 
+TEST(AMessage, CanDeserializeAStringIntoAStringViewBorrowedFromTheMessage)
+{
+    auto msg = sdbus::createPlainMessage();
+
+    const std::string dataWritten = "Hello";
+
+    msg << dataWritten;
+    msg.seal();
+
+    std::string_view dataRead;
+    msg >> dataRead;
+
+    ASSERT_THAT(dataRead, Eq(dataWritten));
+}
+
+TEST(AMessage, CanDeserializeDBusArrayOfStringsIntoStdVectorOfStringViews)
+{
+    auto msg = sdbus::createPlainMessage();
+
+    const std::vector<std::string> dataWritten{"s1", "s2", "s3"};
+
+    msg << dataWritten;
+    msg.seal();
+
+    std::vector<std::string_view> dataRead;
+    msg >> dataRead;
+
+    ASSERT_THAT(dataRead, ElementsAre("s1", "s2", "s3"));
+}
+
 TEST(AMessage, CanCarryAUnixFd)
 {
     auto msg = sdbus::createPlainMessage();
@@ -437,6 +502,213 @@ TEST(AMessage, ThrowsWhenDestinationStdSpanIsTooSmallDuringDeserialization)
 }
 #endif
 
+TEST(AMessage, DeserializesLargeDBusArrayOfStructsWithOneAllocationPerDoublingOfChunks)
+{
+    using Element = sdbus::Struct<int32_t, int32_t>;
+    constexpr auto chunkSize = sdbus::detail::array_chunk_size_v<Element>;
+    constexpr std::size_t size = 32 * chunkSize;
+    auto msg = sdbus::createPlainMessage();
+    msg << std::vector<Element>(size, Element{1, 2});
+    msg.seal();
+
+    std::vector<Element, CountingAllocator<Element>> dataRead;
+    AllocationCounter::count = 0;
+    msg >> dataRead;
+
+    ASSERT_THAT(dataRead, SizeIs(size));
+    ASSERT_THAT(dataRead.back(), Eq(Element{1, 2}));
+    // The vector grows per chunk of elements, not per element, i.e. 1 + log2(32) times instead of 1 + log2(size) times
+    ASSERT_THAT(AllocationCounter::count, Eq(6));
+}
+
+TEST(AMessage, CanCarryDBusArrayOfFixedSizeStructs)
+{
+    using Element = sdbus::Struct<double, bool, sdbus::Struct<int16_t, uint64_t>>;
+    auto msg = sdbus::createPlainMessage();
+
+    const std::vector<Element> dataWritten{{3.14, true, {-1, 42}}, {2.72, false, {7, 0}}, {0.0, true, {0, UINT64_MAX}}};
+
+    msg << dataWritten;
+    msg << int32_t{2026};
+    msg.seal();
+
+    std::vector<Element> dataRead;
+    int32_t trailing{};
+    msg >> dataRead >> trailing;
+
+    ASSERT_THAT(dataRead, Eq(dataWritten));
+    ASSERT_THAT(trailing, Eq(2026));
+}
+
+TEST(AMessage, DeserializesDBusArrayFittingInOneChunkWithExactlyOneAllocation)
+{
+    using Element = sdbus::Struct<int32_t, int32_t>;
+
+    for (const std::size_t size : {std::size_t{1}, std::size_t{100}, sdbus::detail::array_chunk_size_v<Element>})
+    {
+        auto msg = sdbus::createPlainMessage();
+        msg << std::vector<Element>(size, Element{1, 2});
+        msg.seal();
+
+        std::vector<Element, CountingAllocator<Element>> dataRead;
+        AllocationCounter::count = 0;
+        msg >> dataRead;
+
+        ASSERT_THAT(dataRead, SizeIs(size));
+        ASSERT_THAT(dataRead.capacity(), Eq(size));
+        ASSERT_THAT(AllocationCounter::count, Eq(1));
+    }
+}
+
+TEST(AMessage, DeserializesDBusArrayIntoPreReservedVectorWithoutAnyAllocation)
+{
+    using Element = sdbus::Struct<int32_t, int32_t>;
+    constexpr std::size_t size = 4'000;
+    auto msg = sdbus::createPlainMessage();
+    msg << std::vector<Element>(size, Element{1, 2});
+    msg.seal();
+
+    std::vector<Element, CountingAllocator<Element>> dataRead;
+    dataRead.reserve(size);
+    AllocationCounter::count = 0;
+    msg >> dataRead;
+
+    ASSERT_THAT(dataRead, SizeIs(size));
+    ASSERT_THAT(AllocationCounter::count, Eq(0));
+}
+
+#ifdef __cpp_lib_memory_resource
+TEST(AMessage, DeserializesPmrContainersEntirelyIntoMessageArena)
+{
+    const std::string longString(100, 'x'); // Beyond small string optimization
+    auto msg = sdbus::createPlainMessage();
+    msg << std::map<int32_t, std::vector<sdbus::Struct<std::string, int32_t>>>{{1, {{longString, 2}, {longString, 3}}}, {4, {{longString, 5}}}};
+    msg.seal();
+
+    sdbus::MessageArena arena;
+    auto dataRead = arena.make<std::pmr::map<int32_t, std::pmr::vector<sdbus::Struct<std::pmr::string, int32_t>>>>();
+    // Any allocation outside of the arena would throw
+    auto* defaultResource = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+    msg >> dataRead;
+    std::pmr::set_default_resource(defaultResource);
+
+    ASSERT_THAT(dataRead, SizeIs(2));
+    ASSERT_THAT(dataRead.at(1), SizeIs(2));
+    EXPECT_THAT(dataRead.at(1)[1].get<0>(), StrEq(longString));
+    EXPECT_THAT(dataRead.at(1)[1].get<1>(), Eq(3));
+    EXPECT_THAT(dataRead.at(4)[0].get<0>().get_allocator().resource(), Eq(arena.resource()));
+}
+
+TEST(AMessageArena, GrowsToHighWaterMarkUponReset)
+{
+    auto msg = sdbus::createPlainMessage();
+    msg << std::vector<std::string>(100, std::string(100, 'x'));
+    msg.seal();
+
+    sdbus::MessageArena arena{64};
+    {
+        auto dataRead = arena.make<std::pmr::vector<std::pmr::string>>();
+        msg >> dataRead;
+        ASSERT_THAT(dataRead, SizeIs(100));
+    }
+    arena.reset();
+    const auto capacity = arena.capacity();
+    ASSERT_THAT(capacity, Gt(100U * 100U));
+
+    {
+        auto dataRead = arena.make<std::pmr::vector<std::pmr::string>>();
+        msg.rewind(true);
+        msg >> dataRead;
+    }
+    arena.reset();
+
+    EXPECT_THAT(arena.capacity(), Eq(capacity));
+}
+
+TEST(AVariant, CanProvideItsValueUsingGivenAllocator)
+{
+    sdbus::MessageArena arena;
+    const sdbus::Variant compactVariant{std::string(100, 'x')};
+    const sdbus::Variant messageVariant{std::vector<std::string>{std::string(100, 'y')}};
+
+    auto str = compactVariant.get<std::pmr::string>(arena.allocator());
+    auto vec = messageVariant.get<std::pmr::vector<std::pmr::string>>(arena.allocator());
+
+    EXPECT_THAT(str, StrEq(std::string(100, 'x')));
+    EXPECT_THAT(str.get_allocator().resource(), Eq(arena.resource()));
+    ASSERT_THAT(vec, SizeIs(1));
+    EXPECT_THAT(vec[0], StrEq(std::string(100, 'y')));
+    EXPECT_THAT(vec[0].get_allocator().resource(), Eq(arena.resource()));
+}
+#endif
+
+TEST(AMessage, CarriesSmallMemfdArrayInline)
+{
+    auto msg = sdbus::createPlainMessage();
+
+    const sdbus::MemfdArray<int32_t> dataWritten{{3545342, 43643532, 324325}};
+    msg << dataWritten;
+    msg.seal();
+
+    sdbus::MemfdArray<int32_t> dataRead;
+    msg >> dataRead;
+
+    ASSERT_FALSE(dataRead.isMemfdBacked());
+    ASSERT_THAT(std::vector(dataRead.begin(), dataRead.end()), ElementsAre(3545342, 43643532, 324325));
+}
+
+TEST(AMessage, CarriesLargeMemfdArrayInSealedMemfd)
+{
+    auto msg = sdbus::createPlainMessage();
+
+    std::vector<uint8_t> items(sdbus::MemfdArray<uint8_t>::DEFAULT_THRESHOLD);
+    for (std::size_t i = 0; i < items.size(); ++i)
+        items[i] = static_cast<uint8_t>(i);
+    const sdbus::MemfdArray<uint8_t> dataWritten{items};
+    msg << dataWritten;
+    msg.seal();
+
+    sdbus::MemfdArray<uint8_t> dataRead;
+    msg >> dataRead;
+
+    ASSERT_TRUE(dataWritten.isMemfdBacked());
+    ASSERT_TRUE(dataRead.isMemfdBacked());
+    ASSERT_THAT(std::vector(dataRead.begin(), dataRead.end()), Eq(items));
+}
+
+TEST(AMessage, CarriesMemfdArrayFilledInPlace)
+{
+    auto msg = sdbus::createPlainMessage();
+
+    auto dataWritten = sdbus::MemfdArray<uint64_t>::create(1024, [](uint64_t* data, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            data[i] = i * i;
+    });
+    msg << dataWritten;
+    msg.seal();
+
+    sdbus::MemfdArray<uint64_t> dataRead;
+    msg >> dataRead;
+
+    ASSERT_TRUE(dataRead.isMemfdBacked());
+    ASSERT_THAT(dataRead.size(), Eq(1024));
+    ASSERT_THAT(dataRead[1000], Eq(1000000));
+}
+
+TEST(AMessage, ThrowsWhenDeserializingMemfdArrayFromUnsealedMemfd)
+{
+    auto msg = sdbus::createPlainMessage();
+
+    sdbus::UnixFd memfd{memfd_create("unsealed", MFD_CLOEXEC), sdbus::adopt_fd};
+    ASSERT_THAT(ftruncate(memfd.get(), 16), Eq(0));
+    msg << sdbus::Struct<std::vector<uint8_t>, std::vector<sdbus::UnixFd>>{std::vector<uint8_t>{}, std::vector{memfd}};
+    msg.seal();
+
+    sdbus::MemfdArray<uint8_t> dataRead;
+    ASSERT_THROW(msg >> dataRead, sdbus::Error);
+}
+
 TEST(AMessage, CanCarryADictionary)
 {
     auto msg = sdbus::createPlainMessage();
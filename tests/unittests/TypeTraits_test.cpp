@@ -24,6 +24,7 @@
  * along with sdbus-c++. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <sdbus-c++/MemfdArray.h>
 #include <sdbus-c++/TypeTraits.h>
 #include <sdbus-c++/Types.h>
 #include <gtest/gtest.h>
@@ -112,6 +113,7 @@ namespace
 #ifdef __cpp_lib_span
     TYPE(std::span<int16_t>)HAS_DBUS_TYPE_SIGNATURE("an")
 #endif
+    TYPE(sdbus::MemfdArray<uint8_t>)HAS_DBUS_TYPE_SIGNATURE("(ayah)")
     TYPE(SomeEnumClass)HAS_DBUS_TYPE_SIGNATURE("y")
     TYPE(const SomeEnumClass)HAS_DBUS_TYPE_SIGNATURE("y")
     TYPE(volatile SomeEnumClass)HAS_DBUS_TYPE_SIGNATURE("y")
@@ -170,6 +172,7 @@ namespace
 #ifdef __cpp_lib_span
                                                , std::span<int16_t>
 #endif
+                                               , sdbus::MemfdArray<uint8_t>
                                                , SomeEnumClass
                                                , const SomeEnumClass
                                                , volatile SomeEnumClass
@@ -193,6 +196,17 @@ TYPED_TEST(Type2DBusTypeSignatureConversion, ConvertsTypeToProperDBusSignature)
     ASSERT_THAT(signature.data(), Eq(this->dbusTypeSignature_));
 }
 
+TEST(StructTypeTraits, DetectsFixedSizeDBusStructs)
+{
+    static_assert(sdbus::is_fixed_size_dbus_struct_v<sdbus::Struct<int32_t, int32_t>>, "(ii) not detected as fixed-size struct");
+    static_assert(sdbus::is_fixed_size_dbus_struct_v<sdbus::Struct<double, bool, SomeEnumClass>>, "(dby) not detected as fixed-size struct");
+    static_assert(sdbus::is_fixed_size_dbus_struct_v<sdbus::Struct<uint8_t, sdbus::Struct<double, double>>>, "(y(dd)) not detected as fixed-size struct");
+    static_assert(!sdbus::is_fixed_size_dbus_struct_v<sdbus::Struct<int32_t, std::string>>, "(is) incorrectly detected as fixed-size struct");
+    static_assert(!sdbus::is_fixed_size_dbus_struct_v<sdbus::Struct<int32_t, sdbus::UnixFd>>, "(ih) incorrectly detected as fixed-size struct");
+    static_assert(!sdbus::is_fixed_size_dbus_struct_v<sdbus::Struct<int32_t, std::vector<int32_t>>>, "(iai) incorrectly detected as fixed-size struct");
+    static_assert(!sdbus::is_fixed_size_dbus_struct_v<int32_t>, "i incorrectly detected as fixed-size struct");
+}
+
 TEST(FreeFunctionTypeTraits, DetectsTraitsOfTrivialSignatureFunction)
 {
     void f();
@@ -204,6 +218,7 @@ TEST(FreeFunctionTypeTraits, DetectsTraitsOfTrivialSignatureFunction)
     static_assert(std::is_same_v<sdbus::tuple_of_function_output_arg_types_t<Fnc>, void>, "Incorrectly detected tuple of free function return types");
     static_assert(sdbus::function_argument_count_v<Fnc> == 0, "Incorrectly detected free function parameter count");
     static_assert(std::is_void_v<sdbus::function_result_t<Fnc>>, "Incorrectly detected free function return type");
+    static_assert(sdbus::accepts_moved_arguments_v<Fnc>, "Incorrectly detected free function argument passing");
 }
 
 TEST(FreeFunctionTypeTraits, DetectsTraitsOfNontrivialSignatureFunction)
@@ -217,6 +232,7 @@ TEST(FreeFunctionTypeTraits, DetectsTraitsOfNontrivialSignatureFunction)
     static_assert(std::is_same_v<sdbus::tuple_of_function_output_arg_types_t<Fnc>, std::tuple<char, int>>, "Incorrectly detected tuple of free function return types");
     static_assert(sdbus::function_argument_count_v<Fnc> == 3, "Incorrectly detected free function parameter count");
     static_assert(std::is_same_v<sdbus::function_result_t<Fnc>, std::tuple<char, int>>, "Incorrectly detected free function return type");
+    static_assert(!sdbus::accepts_moved_arguments_v<Fnc>, "Incorrectly detected free function argument passing");
 }
 
 TEST(FreeFunctionTypeTraits, DetectsTraitsOfAsyncFunction)
@@ -230,4 +246,5 @@ TEST(FreeFunctionTypeTraits, DetectsTraitsOfAsyncFunction)
     static_assert(std::is_same_v<sdbus::tuple_of_function_output_arg_types_t<Fnc>, std::tuple<char, int>>, "Incorrectly detected tuple of free function return types");
     static_assert(sdbus::function_argument_count_v<Fnc> == 3, "Incorrectly detected free function parameter count");
     static_assert(std::is_same_v<sdbus::function_result_t<Fnc>, std::tuple<char, int>>, "Incorrectly detected free function return type");
+    static_assert(!sdbus::accepts_moved_arguments_v<Fnc>, "Incorrectly detected free function argument passing");
 }
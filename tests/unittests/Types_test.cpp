@@ -331,6 +331,41 @@ TEST(CopiesOfVariant, SerializeToAndDeserializeFromMessageSuccessfully)
     ASSERT_THAT(receivedVariant3.get<ComplexType>(), Eq(value));
 }
 
+TEST(ASimpleVariant, SerializesToAndDeserializesFromAMessageSuccessfully)
+{
+    const sdbus::Variant variant1{ANY_UINT64};
+    const sdbus::Variant variant2{"hello"s};
+    const sdbus::Variant variant3{sdbus::ObjectPath{"/some/path"}};
+    const sdbus::Variant variant4{sdbus::Signature{"a{sv}"}};
+
+    auto msg = sdbus::createPlainMessage();
+    variant1.serializeTo(msg);
+    variant2.serializeTo(msg);
+    variant3.serializeTo(msg);
+    variant4.serializeTo(msg);
+    msg.seal();
+    sdbus::Variant receivedVariant1, receivedVariant2, receivedVariant3, receivedVariant4; // NOLINT(readability-isolate-declaration)
+    receivedVariant1.deserializeFrom(msg);
+    receivedVariant2.deserializeFrom(msg);
+    receivedVariant3.deserializeFrom(msg);
+    receivedVariant4.deserializeFrom(msg);
+
+    ASSERT_THAT(receivedVariant1.get<uint64_t>(), Eq(ANY_UINT64));
+    ASSERT_THAT(receivedVariant2.get<std::string>(), Eq("hello"));
+    ASSERT_TRUE(receivedVariant3.containsValueOfType<sdbus::ObjectPath>());
+    ASSERT_THAT(receivedVariant3.get<sdbus::ObjectPath>(), Eq("/some/path"));
+    ASSERT_TRUE(receivedVariant4.containsValueOfType<sdbus::Signature>());
+    ASSERT_THAT(receivedVariant4.get<sdbus::Signature>(), Eq("a{sv}"));
+}
+
+TEST(ASimpleVariant, ThrowsWhenAskedForValueOfDifferentType)
+{
+    const sdbus::Variant variant{"hello"s};
+
+    ASSERT_THROW(variant.get<sdbus::ObjectPath>(), sdbus::Error);
+    ASSERT_THROW(variant.get<int32_t>(), sdbus::Error);
+}
+
 TEST(AStruct, CanBeCreatedFromStdTuple)
 {
     std::tuple<int32_t, std::string> value{1234, "abcd"};
@@ -99,6 +99,9 @@ public:
     MOCK_METHOD2(sd_bus_creds_get_egid, int(sd_bus_creds *, gid_t *));
     MOCK_METHOD2(sd_bus_creds_get_supplementary_gids, int(sd_bus_creds *, const gid_t **));
     MOCK_METHOD2(sd_bus_creds_get_selinux_context, int(sd_bus_creds *, const char **));
+
+    MOCK_METHOD0(lock, void());
+    MOCK_METHOD0(unlock, void());
 };
 
 #endif //SDBUS_CXX_SDBUS_MOCK_H
@@ -183,6 +183,7 @@ std::tuple<std::vector<std::string>, std::string> AdaptorGenerator::processMetho
 
         auto annotations = getAnnotations(*method);
         bool async{false};
+        bool coroutine{false};
         std::string annotationRegistration;
         for (const auto& annotation : annotations)
         {
@@ -204,24 +205,37 @@ std::tuple<std::vector<std::string>, std::string> AdaptorGenerator::processMetho
                 if (annotationValue == "server" || annotationValue == "clientserver" || annotationValue == "client-server")
                     async = true;
             }
+            else if (annotationName == "org.freedesktop.DBus.Method.Async.ServerImpl")
+            {
+                if (annotationValue == "coroutine")
+                    coroutine = true;
+                else if (annotationValue != "result")
+                    std::cerr << "Node: " << methodName << ": "
+                              << "Value '" << annotationValue << "' of option '" << annotationName << "' not supported! Option ignored..." << std::endl;
+            }
             else if (annotationName == "org.freedesktop.systemd1.Privileged")
             {
                 if (annotationValue == "true")
                     annotationRegistration += ".markAsPrivileged()";
             }
-            else if (annotationName != "org.freedesktop.DBus.Method.Timeout") // Whatever else...
+            else if (annotationName != "org.freedesktop.DBus.Method.Timeout"
+                  && annotationName != "org.freedesktop.DBus.Method.Async.ClientImpl") // Whatever else...
             {
                 std::cerr << "Node: " << methodName << ": "
                           << "Option '" << annotationName << "' not allowed or supported in this context! Option ignored..." << std::endl;
             }
         }
 
+        // Server-side async methods are implemented either through sdbus::Result, or as coroutines returning sdbus::Task
+        coroutine = coroutine && async;
+        async = async && !coroutine;
+
         Nodes args = (*method)["arg"];
         Nodes inArgs = args.select("direction" , "in");
         Nodes outArgs = args.select("direction" , "out");
 
         std::string argStr, argTypeStr, argStringsStr, outArgStringsStr;
-        std::tie(argStr, argTypeStr, std::ignore, argStringsStr) = argsToNamesAndTypes(inArgs, async);
+        std::tie(argStr, argTypeStr, std::ignore, argStringsStr) = argsToNamesAndTypes(inArgs, async || coroutine, /*allowStringViews*/ !async, /*allowByValue*/ true);
         std::tie(std::ignore, std::ignore, std::ignore, outArgStringsStr) = argsToNamesAndTypes(outArgs);
 
         using namespace std::string_literals;
@@ -243,7 +257,7 @@ std::tuple<std::vector<std::string>, std::string> AdaptorGenerator::processMetho
 
         declarationSS << tab
                 << "virtual "
-                << (async ? "void" : outArgsToType(outArgs))
+                << (async ? "void" : coroutine ? "sdbus::Task<" + outArgsToType(outArgs) + ">" : outArgsToType(outArgs))
                 << " " << methodNameSafe
                 << "("
                 << (async ? "sdbus::Result<" + outArgsToType(outArgs, true) + ">&& result" + (argTypeStr.empty() ? "" : ", ") : "")
@@ -284,7 +298,7 @@ std::tuple<std::vector<std::string>, std::string> AdaptorGenerator::processSigna
         Nodes args = (*signal)["arg"];
 
         std::string argStr, argTypeStr, typeStr, argStringsStr;
-        std::tie(argStr, argTypeStr, typeStr, argStringsStr) = argsToNamesAndTypes(args);
+        std::tie(argStr, argTypeStr, typeStr, argStringsStr) = argsToNamesAndTypes(args, false, /*allowStringViews*/ true);
 
         signalRegistrationSS << "sdbus::registerSignal(\"" << name << "\")";
 
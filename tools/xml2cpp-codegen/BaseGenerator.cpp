@@ -106,7 +106,7 @@ std::tuple<unsigned, std::string> BaseGenerator::generateNamespaces(const std::s
 }
 
 
-std::tuple<std::string, std::string, std::string, std::string> BaseGenerator::argsToNamesAndTypes(const Nodes& args, bool async) const
+std::tuple<std::string, std::string, std::string, std::string> BaseGenerator::argsToNamesAndTypes(const Nodes& args, bool async, bool allowStringViews, bool allowByValue) const
 {
     std::ostringstream argSS, argTypeSS, typeSS, argStringsSS;
 
@@ -127,9 +127,20 @@ std::tuple<std::string, std::string, std::string, std::string> BaseGenerator::ar
             argName = "arg" + std::to_string(i);
         }
         auto argNameSafe = mangle_name(argName);
-        auto type = signature_to_type(arg->get("type"));
+
+        bool stringViews{false};
+        bool byValue{false};
+        for (const auto& annotation : (*arg)["annotation"])
+        {
+            if (allowStringViews && annotation->get("name") == "org.sdbuscpp.StringView" && annotation->get("value") == "true")
+                stringViews = true;
+            if (allowByValue && annotation->get("name") == "org.sdbuscpp.ByValue" && annotation->get("value") == "true")
+                byValue = true;
+        }
+
+        auto type = signature_to_type(arg->get("type"), stringViews);
         argStringsSS << "\"" << argName << "\"";
-        if (!async)
+        if (!async && !byValue)
         {
             argSS << argNameSafe;
             argTypeSS << "const " << type << "& " << argNameSafe;
@@ -86,9 +86,14 @@ protected:
     /**
      * Transform arguments into source code
      * @param args
+     * @param async
+     * @param allowStringViews whether strings of args annotated with org.sdbuscpp.StringView shall be std::string_view
+     *        (only safe for args that are serialized, or deserialized args whose message outlives the handler)
+     * @param allowByValue whether args annotated with org.sdbuscpp.ByValue shall be passed by value and moved along
+     *        (only meaningful for deserialized args handed over to the handler)
      * @return tuple: argument names, argument types and names, argument types
      */
-    std::tuple<std::string, std::string, std::string, std::string> argsToNamesAndTypes(const sdbuscpp::xml::Nodes& args, bool async = false) const;
+    std::tuple<std::string, std::string, std::string, std::string> argsToNamesAndTypes(const sdbuscpp::xml::Nodes& args, bool async = false, bool allowStringViews = false, bool allowByValue = false) const;
 
     /**
      * Output arguments to return type
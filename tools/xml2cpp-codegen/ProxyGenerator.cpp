@@ -219,9 +219,9 @@ std::tuple<std::string, std::string> ProxyGenerator::processMethods(const Nodes&
         auto retType = outArgsToType(outArgs);
         auto retTypeBare = outArgsToType(outArgs, true);
         std::string inArgStr, inArgTypeStr;
-        std::tie(inArgStr, inArgTypeStr, std::ignore, std::ignore) = argsToNamesAndTypes(inArgs);
+        std::tie(inArgStr, inArgTypeStr, std::ignore, std::ignore) = argsToNamesAndTypes(inArgs, false, /*allowStringViews*/ true);
         std::string outArgStr, outArgTypeStr;
-        std::tie(outArgStr, outArgTypeStr, std::ignore, std::ignore) = argsToNamesAndTypes(outArgs);
+        std::tie(outArgStr, outArgTypeStr, std::ignore, std::ignore) = argsToNamesAndTypes(outArgs, false, /*allowStringViews*/ asyncImpl == AsyncImpl::Callback && !dontExpectReply);
 
         // Determine return type based on async implementation
         std::string realRetType;
@@ -335,7 +335,7 @@ std::tuple<std::string, std::string> ProxyGenerator::processSignals(const Nodes&
         nameBigFirst[0] = islower(nameBigFirst[0]) ? nameBigFirst[0] + 'A' - 'a' : nameBigFirst[0];
 
         std::string argStr, argTypeStr;
-        std::tie(argStr, argTypeStr, std::ignore, std::ignore) = argsToNamesAndTypes(args);
+        std::tie(argStr, argTypeStr, std::ignore, std::ignore) = argsToNamesAndTypes(args, false, /*allowStringViews*/ true);
 
         registrationSS << tab << tab << "m_proxy"
                 ".uponSignal(\"" << name << "\")"
@@ -57,7 +57,7 @@ const char *atomic_type_to_string(char t)
     return nullptr;
 }
 
-static void _parse_signature(const std::string &signature, std::string &type, unsigned int &i, bool only_once = false)
+static void _parse_signature(const std::string &signature, std::string &type, unsigned int &i, bool stringViews, bool only_once = false)
 {
     for (; i < signature.length(); ++i)
     {
@@ -71,7 +71,7 @@ static void _parse_signature(const std::string &signature, std::string &type, un
                     {
                         type += "std::map<";
                         ++i;
-                        _parse_signature(signature, type, i);
+                        _parse_signature(signature, type, i, stringViews);
                         type += ">";
 
                         break;
@@ -80,7 +80,7 @@ static void _parse_signature(const std::string &signature, std::string &type, un
                     {
                         type += "std::vector<sdbus::Struct<";
                         ++i;
-                        _parse_signature(signature, type, i);
+                        _parse_signature(signature, type, i, stringViews);
                         type += ">>";
 
                         break;
@@ -97,7 +97,7 @@ static void _parse_signature(const std::string &signature, std::string &type, un
                     default:
                     {
                         type += "std::vector<";
-                        _parse_signature(signature, type, i, true);
+                        _parse_signature(signature, type, i, stringViews, true);
 
                         type += ">";
 
@@ -111,7 +111,7 @@ static void _parse_signature(const std::string &signature, std::string &type, un
                 type += "sdbus::Struct<";
                 ++i;
 
-                _parse_signature(signature, type, i);
+                _parse_signature(signature, type, i, stringViews);
 
                 type += ">";
                 break;
@@ -123,7 +123,7 @@ static void _parse_signature(const std::string &signature, std::string &type, un
             }
             default:
             {
-                const char *atom = atomic_type_to_string(signature[i]);
+                const char *atom = stringViews && signature[i] == 's' ? "std::string_view" : atomic_type_to_string(signature[i]);
                 if (!atom)
                 {
                     std::cerr << "Invalid signature: " << signature << std::endl;
@@ -145,11 +145,11 @@ static void _parse_signature(const std::string &signature, std::string &type, un
     }
 }
 
-std::string signature_to_type(const std::string& signature)
+std::string signature_to_type(const std::string& signature, bool stringViews)
 {
     std::string type;
     unsigned int i = 0;
-    _parse_signature(signature, type, i);
+    _parse_signature(signature, type, i, stringViews);
     return type;
 }
 
@@ -13,7 +13,8 @@ const char *atomic_type_to_string(char t);
 
 std::string stub_name(const std::string& name);
 
-std::string signature_to_type(const std::string& signature);
+// With stringViews set, D-Bus strings are mapped to std::string_view instead of std::string
+std::string signature_to_type(const std::string& signature, bool stringViews = false);
 
 std::string underscorize(const std::string& str);
 